@@ -1,14 +1,23 @@
 #include <iostream>
 #include <vector>
 #include <string>
-#include <fstream>
+#include <string_view>
 #include <algorithm>
-#include <unordered_map>
+#include <array>
+#include <cstdint>
+#include <execution>
 #include <stdexcept>
 #include <filesystem>
 #include <utility>
 #include <numeric>
 
+#include "../../common/input.hpp"
+#include "../../common/solve.hpp"
+#include "../../common/thread_pool.hpp"
+
+namespace aoc2024::day1
+{
+
 struct InputData
 {
     std::vector<int> left_column;
@@ -20,34 +29,25 @@ struct InputData
 
 [[nodiscard]] InputData read_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
+    const aoc::MappedFile file(file_path);
+    std::string_view text = file.view();
 
     InputData data;
 
-    const auto file_size = std::filesystem::file_size(file_path);
     constexpr size_t kAvgBytesPerLine = 10;
-    const size_t estimated_lines = file_size / kAvgBytesPerLine;
+    const size_t estimated_lines = file.size() / kAvgBytesPerLine;
 
     data.left_column.reserve(estimated_lines);
     data.right_column.reserve(estimated_lines);
 
     int left_number, right_number;
-    while (file >> left_number >> right_number)
+    while (aoc::consume_int(text, left_number) && aoc::consume_int(text, right_number))
     {
         data.left_column.emplace_back(left_number);
         data.right_column.emplace_back(right_number);
     }
 
-    if (!file.eof())
+    if (!aoc::trim(text).empty())
     {
         throw std::runtime_error("Error reading file: " + file_path.string() +
                                  " - invalid format at line " +
@@ -60,52 +60,204 @@ struct InputData
     return data;
 }
 
-[[nodiscard]] long long advent_of_code_2024_day1_part1(const std::filesystem::path &file_path)
+// LSD radix sort on bytes of the sign-flipped key; passes whose byte is the same
+// for every value (the high bytes of small ids) are skipped
+void radix_sort(std::vector<int> &values)
 {
-    auto data = read_input(file_path);
+    constexpr int kDigitBits = 8;
+    constexpr int kDigits = 32 / kDigitBits;
+    constexpr size_t kBuckets = size_t{1} << kDigitBits;
 
-    std::sort(data.left_column.begin(), data.left_column.end());
-    std::sort(data.right_column.begin(), data.right_column.end());
+    const auto key = [](const int value)
+    {
+        return static_cast<std::uint32_t>(value) ^ 0x80000000U;
+    };
 
-    const long long distance_sum = std::transform_reduce(
-        data.left_column.cbegin(), data.left_column.cend(),
-        data.right_column.cbegin(),
-        0LL,
-        std::plus<>{},
-        [](const int left, const int right)
+    std::array<std::array<size_t, kBuckets>, kDigits> histograms{};
+    for (const auto value : values)
+    {
+        const auto k = key(value);
+        for (int digit = 0; digit < kDigits; ++digit)
         {
-            return std::abs(left - right);
-        });
+            ++histograms[digit][(k >> (digit * kDigitBits)) & (kBuckets - 1)];
+        }
+    }
 
-    return distance_sum;
+    std::vector<int> scratch(values.size());
+    for (int digit = 0; digit < kDigits; ++digit)
+    {
+        auto &counts = histograms[digit];
+        if (std::ranges::find(counts, values.size()) != counts.end())
+        {
+            continue;
+        }
+
+        std::exclusive_scan(counts.begin(), counts.end(), counts.begin(), size_t{0});
+        for (const auto value : values)
+        {
+            scratch[counts[(key(value) >> (digit * kDigitBits)) & (kBuckets - 1)]++] = value;
+        }
+        values.swap(scratch);
+    }
 }
 
-[[nodiscard]] long long advent_of_code_2024_day1_part2(const std::filesystem::path &file_path)
+[[nodiscard]] long long sum_distances(const std::vector<int> &left, const std::vector<int> &right)
 {
-    const auto data = read_input(file_path);
+    const auto distance_sum = [&](const size_t first, const size_t last)
+    {
+        return std::transform_reduce(
+            std::execution::unseq,
+            left.cbegin() + first, left.cbegin() + last,
+            right.cbegin() + first,
+            0LL,
+            std::plus<>{},
+            [](const int left_value, const int right_value)
+            {
+                return std::abs(static_cast<long long>(left_value) - right_value);
+            });
+    };
 
-    std::unordered_map<int, int> right_column_count;
-    right_column_count.reserve(data.right_column.size());
+    constexpr size_t kParallelThreshold = size_t{1} << 22;
+    const size_t n = left.size();
+    const unsigned threads = n < kParallelThreshold ? 1U : aoc::ThreadBudget::threads();
+    if (threads < 2)
+    {
+        return distance_sum(0, n);
+    }
 
-    for (const auto num : data.right_column)
+    std::vector<long long> partial(threads, 0LL);
     {
-        ++right_column_count[num];
+        aoc::ThreadPool pool(threads);
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            pool.submit([&, t]
+                        { partial[t] = distance_sum(n * t / threads, n * (t + 1) / threads); });
+        }
+        pool.wait();
     }
+    return std::accumulate(partial.begin(), partial.end(), 0LL);
+}
 
+[[nodiscard]] long long advent_of_code_2024_day1_part1(InputData data)
+{
+    radix_sort(data.left_column);
+    radix_sort(data.right_column);
+
+    return sum_distances(data.left_column, data.right_column);
+}
+
+[[nodiscard]] long long advent_of_code_2024_day1_part1(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2024_day1_part1(read_input(file_path));
+}
+
+// Runs of equal ids in both sorted columns contribute id * left_count * right_count
+[[nodiscard]] long long merge_join_similarity(const std::vector<int> &left, const std::vector<int> &right)
+{
     long long similarity_sum = 0LL;
-    for (const auto left_num : data.left_column)
+    size_t i = 0, j = 0;
+    while (i < left.size() && j < right.size())
+    {
+        if (left[i] < right[j])
+        {
+            ++i;
+        }
+        else if (right[j] < left[i])
+        {
+            ++j;
+        }
+        else
+        {
+            const int value = left[i];
+            const size_t left_start = i, right_start = j;
+            while (i < left.size() && left[i] == value)
+            {
+                ++i;
+            }
+            while (j < right.size() && right[j] == value)
+            {
+                ++j;
+            }
+            similarity_sum += static_cast<long long>(value) *
+                              static_cast<long long>(i - left_start) *
+                              static_cast<long long>(j - right_start);
+        }
+    }
+    return similarity_sum;
+}
+
+[[nodiscard]] long long advent_of_code_2024_day1_part2(const InputData &data)
+{
+    if (data.empty())
+    {
+        return 0LL;
+    }
+
+    const auto [min_it, max_it] = std::minmax_element(data.left_column.cbegin(), data.left_column.cend());
+    const long long lowest = *min_it;
+    const auto range = static_cast<size_t>(*max_it - lowest + 1);
+
+    // Dense counts over the left value range when that costs no more than a few entries per id
+    constexpr size_t kMinDenseRange = size_t{1} << 16;
+    if (range > std::max(kMinDenseRange, 4 * data.size()))
+    {
+        auto left = data.left_column;
+        auto right = data.right_column;
+        radix_sort(left);
+        radix_sort(right);
+        return merge_join_similarity(left, right);
+    }
+
+    std::vector<std::uint32_t> right_column_count(range, 0U);
+    for (const auto num : data.right_column)
     {
-        if (const auto it = right_column_count.find(left_num); it != right_column_count.end())
+        const auto offset = static_cast<size_t>(num - lowest);
+        if (offset < range)
         {
-            similarity_sum += static_cast<long long>(left_num) * it->second;
+            ++right_column_count[offset];
         }
     }
 
+    long long similarity_sum = 0LL;
+    for (const auto left_num : data.left_column)
+    {
+        similarity_sum += static_cast<long long>(left_num) * right_column_count[static_cast<size_t>(left_num - lowest)];
+    }
+
     return similarity_sum;
 }
 
+[[nodiscard]] long long advent_of_code_2024_day1_part2(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2024_day1_part2(read_input(file_path));
+}
+
+/**
+ * @brief Solve both parts of Advent of Code 2024 Day 1 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2024_day1_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2024_day1_part2(input); });
+}
+
+} // namespace aoc2024::day1
+
+#ifndef AOC_RUNNER
 int main()
 {
+    using namespace aoc2024::day1;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -113,22 +265,20 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2024_day1_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Sum of distances: " << result1_example << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2024_day1_part2(example_file);
         std::cout << "Similarity score: " << result2_example << std::endl;
 
         std::cout << std::endl;
 
         std::cout << "=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2024_day1_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Sum of distances: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2024_day1_part2(input_file);
         std::cout << "Similarity score: " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -138,4 +288,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
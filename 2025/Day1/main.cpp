@@ -1,14 +1,20 @@
 #include <iostream>
 #include <vector>
 #include <string>
-#include <fstream>
-#include <utility>
 #include <string_view>
 #include <optional>
-#include <expected>
+#include <algorithm>
 #include <filesystem>
 #include <stdexcept>
 #include <charconv>
+#include <cstddef>
+#include <utility>
+
+#include "../../common/input.hpp"
+#include "../../common/thread_pool.hpp"
+
+namespace aoc2025::day1
+{
 
 /**
  * @enum Direction
@@ -48,6 +54,15 @@ struct Instruction
      */
     explicit Instruction(char dir, int st) : direction(parse_direction(dir)), steps(st) {}
 
+    /**
+     * @brief Get the signed movement of the instruction.
+     * @return steps for Right, -steps for Left
+     */
+    [[nodiscard]] constexpr int delta() const noexcept
+    {
+        return direction == Direction::Right ? steps : -steps;
+    }
+
     /**
      * @brief Parse a character into a Direction enum value.
      * @param dir The character to parse ('R' or 'L')
@@ -68,6 +83,63 @@ struct Instruction
     }
 };
 
+/**
+ * @brief Parse one instruction line.
+ *
+ * @param raw_line Line of the input, surrounding whitespace allowed
+ * @param line_number 1-based line number used in error messages
+ * @return The instruction, or std::nullopt for a blank line
+ * @throws std::runtime_error if the line is not a direction followed by a non-negative step count
+ */
+[[nodiscard]] std::optional<Instruction> parse_instruction(std::string_view raw_line, size_t line_number)
+{
+    const auto line = aoc::trim(raw_line);
+    if (line.empty())
+    {
+        return std::nullopt;
+    }
+
+    if (line.length() < 2)
+    {
+        throw std::runtime_error("Invalid instruction format at line " +
+                                 std::to_string(line_number) + ": " + std::string(line));
+    }
+
+    const char direction_char = line[0];
+    const std::string_view number_part = line.substr(1);
+
+    int steps = 0;
+    const auto [ptr, ec] = std::from_chars(number_part.data(),
+                                           number_part.data() + number_part.size(),
+                                           steps);
+
+    if (ec == std::errc::invalid_argument)
+    {
+        throw std::runtime_error("Invalid number format at line " +
+                                 std::to_string(line_number) + ": " + std::string(line));
+    }
+    if (ec == std::errc::result_out_of_range)
+    {
+        throw std::runtime_error("Number out of range at line " +
+                                 std::to_string(line_number) + ": " + std::string(line));
+    }
+    if (steps < 0)
+    {
+        throw std::runtime_error("Negative steps value at line " +
+                                 std::to_string(line_number) + ": " + std::string(line));
+    }
+
+    try
+    {
+        return Instruction(direction_char, steps);
+    }
+    catch (const std::invalid_argument &e)
+    {
+        throw std::runtime_error(std::string("At line ") +
+                                 std::to_string(line_number) + ": " + e.what());
+    }
+}
+
 /**
  * @brief Read and parse instructions from an input file.
  *
@@ -81,124 +153,282 @@ struct Instruction
  */
 [[nodiscard]] std::vector<Instruction> read_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
+    const aoc::MappedFile file(file_path);
 
     std::vector<Instruction> instructions;
 
-    const auto file_size = std::filesystem::file_size(file_path);
     constexpr size_t kAvgBytesPerInstruction = 5;
-    instructions.reserve(file_size / kAvgBytesPerInstruction);
+    instructions.reserve(file.size() / kAvgBytesPerInstruction);
 
-    std::string line;
     size_t line_number = 0;
-
-    while (file >> line)
+    for (const auto raw_line : aoc::lines(file.view()))
     {
-        ++line_number;
-
-        if (line.empty())
+        if (const auto instruction = parse_instruction(raw_line, ++line_number))
         {
-            continue;
+            instructions.push_back(*instruction);
         }
+    }
 
-        if (line.length() < 2)
-        {
-            throw std::runtime_error("Invalid instruction format at line " +
-                                     std::to_string(line_number) + ": " + line);
-        }
+    instructions.shrink_to_fit();
+    return instructions;
+}
+
+/**
+ * @brief Map an input file for streaming through fold_dial().
+ *
+ * The instructions are parsed while they are folded, so the runner times
+ * the streaming and chunked parallel paths rather than read_input().
+ *
+ * @param file_path Path to the input file
+ * @return The mapped file
+ * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ */
+[[nodiscard]] aoc::MappedFile map_input(const std::filesystem::path &file_path)
+{
+    return aoc::MappedFile(file_path);
+}
 
-        const char direction_char = line[0];
-        const std::string_view number_part(line.data() + 1, line.length() - 1);
+/**
+ * @struct DialFold
+ * @brief Running state of the dial, updated one signed rotation at a time.
+ *
+ * Both parts are tracked together. A rotation by delta from position p
+ * passes 0 once for every multiple of the dial size in (p, p + delta] when
+ * turning right. Turning left is the same count on the mirrored dial, where
+ * the position becomes (size - p) % size, so one division covers both
+ * directions and the direction only selects an operand.
+ */
+struct DialFold
+{
+    static constexpr int kDialSize = 100;        ///< Number of dial positions
+    static constexpr int kStartingPosition = 50; ///< Position before the first rotation
 
-        int steps = 0;
-        const auto [ptr, ec] = std::from_chars(number_part.data(),
-                                               number_part.data() + number_part.size(),
-                                               steps);
+    int position = kStartingPosition;  ///< Current position, 0..kDialSize-1
+    unsigned long long landings = 0;   ///< Rotations that ended on 0 (part 1)
+    unsigned long long crossings = 0;  ///< Clicks that passed or reached 0 (part 2)
 
-        if (ec == std::errc::invalid_argument)
-        {
-            throw std::runtime_error("Invalid number format at line " +
-                                     std::to_string(line_number) + ": " + line);
-        }
-        if (ec == std::errc::result_out_of_range)
-        {
-            throw std::runtime_error("Number out of range at line " +
-                                     std::to_string(line_number) + ": " + line);
-        }
-        if (steps < 0)
+    /**
+     * @brief Apply one rotation.
+     * @param delta Signed step count, positive for Right
+     */
+    constexpr void apply(int delta) noexcept
+    {
+        const long long distance = delta < 0 ? -static_cast<long long>(delta) : delta;
+        const int mirrored = delta < 0 ? (kDialSize - position) % kDialSize : position;
+        crossings += static_cast<unsigned long long>((mirrored + distance) / kDialSize);
+
+        position = ((position + delta % kDialSize) % kDialSize + kDialSize) % kDialSize;
+        landings += position == 0 ? 1U : 0U;
+    }
+};
+
+/**
+ * @struct ChunkSummary
+ * @brief Position-independent facts about a slice of the input.
+ */
+struct ChunkSummary
+{
+    int shift = 0;     ///< Net rotation of the slice modulo the dial size
+    size_t lines = 0;  ///< Number of lines in the slice
+    bool valid = true; ///< False if some line failed to parse
+};
+
+/**
+ * @brief Fold instructions straight out of a text buffer.
+ *
+ * Parses and applies one line at a time, so no instruction vector is built.
+ *
+ * @param text Instruction lines
+ * @param fold Starting state; updated in place
+ * @param first_line Line number of the first line of text, for error messages
+ * @throws std::runtime_error if a line is malformed
+ */
+void fold_text(std::string_view text, DialFold &fold, size_t first_line = 1)
+{
+    size_t line_number = first_line;
+    for (const auto raw_line : aoc::lines(text))
+    {
+        if (const auto instruction = parse_instruction(raw_line, line_number))
         {
-            throw std::runtime_error("Negative steps value at line " +
-                                     std::to_string(line_number) + ": " + line);
+            fold.apply(instruction->delta());
         }
+        ++line_number;
+    }
+}
 
+/**
+ * @brief Compute the net rotation of a slice without knowing where it starts.
+ *
+ * @param text Instruction lines
+ * @return Net shift and line count; errors are only flagged, not thrown
+ */
+[[nodiscard]] ChunkSummary summarize_text(std::string_view text) noexcept
+{
+    ChunkSummary summary;
+    for (const auto raw_line : aoc::lines(text))
+    {
+        ++summary.lines;
         try
         {
-            instructions.emplace_back(direction_char, steps);
+            if (const auto instruction = parse_instruction(raw_line, summary.lines))
+            {
+                summary.shift = (summary.shift + instruction->delta() % DialFold::kDialSize +
+                                 DialFold::kDialSize) % DialFold::kDialSize;
+            }
         }
-        catch (const std::invalid_argument &e)
+        catch (...)
         {
-            throw std::runtime_error(std::string("At line ") +
-                                     std::to_string(line_number) + ": " + e.what());
+            summary.valid = false;
+            return summary;
         }
     }
+    return summary;
+}
 
-    instructions.shrink_to_fit();
-    return instructions;
+/**
+ * @brief Split a buffer into about `parts` slices that end on line breaks.
+ *
+ * @param text Whole input
+ * @param parts Desired number of slices
+ * @return Consecutive slices covering the text
+ */
+[[nodiscard]] std::vector<std::string_view> split_at_lines(std::string_view text, size_t parts)
+{
+    std::vector<std::string_view> chunks;
+    const size_t target = text.size() / parts + 1;
+    while (!text.empty())
+    {
+        size_t cut = std::min(target, text.size());
+        const size_t newline = text.find('\n', cut - 1);
+        cut = newline == std::string_view::npos ? text.size() : newline + 1;
+        chunks.push_back(text.substr(0, cut));
+        text.remove_prefix(cut);
+    }
+    return chunks;
 }
 
 /**
- * @brief Solve Advent of Code 2025 Day 1 Part 1.
+ * @brief Simulate the dial over a whole input buffer.
  *
- * Simulates movement on a circular dial with positions 0-99. Starting at position 50,
- * executes all instructions and counts how many times the position lands exactly on 0.
- * The dial wraps around (position 0 follows position 99 and vice versa).
+ * Small inputs are folded in a single streaming pass. Large ones are cut
+ * into line-aligned chunks processed in two parallel passes: the first
+ * finds each chunk's net rotation, a prefix scan over those gives every
+ * chunk its starting position, and the second pass folds the chunks
+ * independently and sums their counts. If any chunk fails to parse the
+ * sequential fold is rerun so the error carries the right line number.
  *
- * @param file_path Path to the input file containing instructions
- * @return The number of times the position lands on 0
- * @throws std::runtime_error if the file cannot be read or contains invalid data
+ * @param text Instruction lines
+ * @return Final dial state with both counters
+ * @throws std::runtime_error if a line is malformed
  */
-[[nodiscard]] unsigned int advent_of_code_2025_day1_part1(const std::filesystem::path &file_path)
+[[nodiscard]] DialFold fold_dial(std::string_view text)
 {
-    const auto instructions = read_input(file_path);
+    constexpr size_t kParallelThreshold = size_t{16} << 20;
+    constexpr size_t kChunksPerThread = 4;
 
-    constexpr unsigned int kDialRange = 99U;
-    constexpr unsigned int kStartingPosition = 50U;
-    constexpr unsigned int kDialSize = kDialRange + 1U;
+    DialFold total;
+    const unsigned threads = aoc::ThreadBudget::threads();
+    if (text.size() < kParallelThreshold || threads < 2)
+    {
+        fold_text(text, total);
+        return total;
+    }
 
-    unsigned int position = kStartingPosition;
-    unsigned int zero_counter = 0U;
+    const auto chunks = split_at_lines(text, threads * kChunksPerThread);
+    std::vector<ChunkSummary> summaries(chunks.size());
+    std::vector<DialFold> folds(chunks.size());
 
-    for (const auto &[direction, steps] : instructions)
+    aoc::ThreadPool pool(threads);
+    for (size_t i = 0; i < chunks.size(); ++i)
     {
-        const auto unsigned_steps = static_cast<unsigned int>(steps);
-        const auto effective_steps = unsigned_steps % kDialSize;
+        pool.submit([&, i]
+                    { summaries[i] = summarize_text(chunks[i]); });
+    }
+    pool.wait();
 
-        switch (direction)
+    size_t first_line = 1;
+    int position = DialFold::kStartingPosition;
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+        if (!summaries[i].valid)
         {
-        case Direction::Right:
-            position = (position + effective_steps) % kDialSize;
-            break;
-        case Direction::Left:
-            position = (position + kDialSize - effective_steps) % kDialSize;
-            break;
+            DialFold sequential;
+            fold_text(text, sequential);
+            return sequential;
         }
+        folds[i].position = position;
+        pool.submit([&, i, first_line]
+                    { fold_text(chunks[i], folds[i], first_line); });
+        position = (position + summaries[i].shift) % DialFold::kDialSize;
+        first_line += summaries[i].lines;
+    }
+    pool.wait();
 
-        if (position == 0U)
-        {
-            ++zero_counter;
-        }
+    for (const auto &fold : folds)
+    {
+        total.landings += fold.landings;
+        total.crossings += fold.crossings;
     }
+    total.position = position;
+    return total;
+}
 
-    return zero_counter;
+/**
+ * @brief Simulate the dial over parsed instructions.
+ *
+ * @param instructions Parsed movement instructions
+ * @return Final dial state with both counters
+ */
+[[nodiscard]] DialFold fold_dial(const std::vector<Instruction> &instructions) noexcept
+{
+    DialFold fold;
+    for (const auto &instruction : instructions)
+    {
+        fold.apply(instruction.delta());
+    }
+    return fold;
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 1 Part 1.
+ *
+ * Simulates movement on a circular dial with positions 0-99. Starting at position 50,
+ * executes all instructions and counts how many times the position lands exactly on 0.
+ * The dial wraps around (position 0 follows position 99 and vice versa).
+ *
+ * @param instructions Parsed movement instructions
+ * @return The number of times the position lands on 0
+ */
+[[nodiscard]] unsigned long long advent_of_code_2025_day1_part1(const std::vector<Instruction> &instructions)
+{
+    return fold_dial(instructions).landings;
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 1 Part 1 on a mapped input file.
+ *
+ * Streams the file through the dial without materializing the
+ * instructions.
+ *
+ * @param file Mapped input file containing instructions
+ * @return The number of times the position lands on 0
+ * @throws std::runtime_error if the file contains invalid data
+ */
+[[nodiscard]] unsigned long long advent_of_code_2025_day1_part1(const aoc::MappedFile &file)
+{
+    return fold_dial(file.view()).landings;
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 1 Part 1 from an input file.
+ *
+ * @param file_path Path to the input file containing instructions
+ * @return The number of times the position lands on 0
+ * @throws std::runtime_error if the file cannot be read or contains invalid data
+ */
+[[nodiscard]] unsigned long long advent_of_code_2025_day1_part1(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day1_part1(map_input(file_path));
 }
 
 /**
@@ -208,76 +438,56 @@ struct Instruction
  * movement, not just when landing on it. For example, moving from position 98 to
  * position 2 crosses 0 once (98->99->0->1->2).
  *
- * Uses an infinite number line representation where position can be negative,
- * then maps back to the 0-99 dial range. This allows for easier calculation
- * of zero crossings during movement.
+ * @param instructions Parsed movement instructions
+ * @return Total number of times position 0 is crossed
+ */
+[[nodiscard]] unsigned long long advent_of_code_2025_day1_part2(const std::vector<Instruction> &instructions)
+{
+    return fold_dial(instructions).crossings;
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 1 Part 2 on a mapped input file.
+ *
+ * @param file Mapped input file containing instructions
+ * @return Total number of times position 0 is crossed
+ * @throws std::runtime_error if the file contains invalid data
+ */
+[[nodiscard]] unsigned long long advent_of_code_2025_day1_part2(const aoc::MappedFile &file)
+{
+    return fold_dial(file.view()).crossings;
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 1 Part 2 from an input file.
  *
  * @param file_path Path to the input file containing instructions
  * @return Total number of times position 0 is crossed
  * @throws std::runtime_error if the file cannot be read or contains invalid data
  */
-[[nodiscard]] unsigned int advent_of_code_2025_day1_part2(const std::filesystem::path &file_path)
+[[nodiscard]] unsigned long long advent_of_code_2025_day1_part2(const std::filesystem::path &file_path)
 {
-    const auto instructions = read_input(file_path);
-
-    constexpr unsigned int kDialRange = 99U;
-    constexpr unsigned int kStartingPosition = 50U;
-    constexpr int kDialSize = static_cast<int>(kDialRange + 1U);
-
-    int position = static_cast<int>(kStartingPosition);
-    unsigned int zero_counter = 0U;
-
-    for (const auto &[direction, steps] : instructions)
-    {
-        unsigned int zero_hits = 0U;
-        const int old_position = position;
-
-        switch (direction)
-        {
-        case Direction::Right:
-        {
-            const int end_pos = old_position + steps;
-            const int first_zero = ((old_position / kDialSize) + 1) * kDialSize;
-
-            if (first_zero <= end_pos)
-            {
-                zero_hits = static_cast<unsigned int>(((end_pos - first_zero) / kDialSize) + 1);
-            }
-
-            position = end_pos % kDialSize;
-            break;
-        }
-        case Direction::Left:
-        {
-            const int end_pos_raw = old_position - steps;
-            int first_zero_in_range = (old_position / kDialSize) * kDialSize;
-
-            if (first_zero_in_range == old_position)
-            {
-                first_zero_in_range -= kDialSize;
-            }
-
-            if (first_zero_in_range >= end_pos_raw)
-            {
-                zero_hits = static_cast<unsigned int>(((first_zero_in_range - end_pos_raw) / kDialSize) + 1);
-            }
-
-            int end_pos_mod = end_pos_raw % kDialSize;
-            if (end_pos_mod < 0)
-            {
-                end_pos_mod += kDialSize;
-            }
-            position = end_pos_mod;
-            break;
-        }
-        }
-
-        zero_counter += zero_hits;
-    }
+    return advent_of_code_2025_day1_part2(map_input(file_path));
+}
 
-    return zero_counter;
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 1 from an input file.
+ *
+ * Both counters come out of the same fold, so the file is streamed once.
+ *
+ * @param file_path Path to the input file containing instructions
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or contains invalid data
+ */
+[[nodiscard]] std::pair<unsigned long long, unsigned long long> solve_both_parts(const std::filesystem::path &file_path)
+{
+    const DialFold fold = fold_dial(map_input(file_path).view());
+    return {fold.landings, fold.crossings};
 }
 
+} // namespace aoc2025::day1
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -288,6 +498,8 @@ struct Instruction
  */
 int main()
 {
+    using namespace aoc2025::day1;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -295,20 +507,18 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day1_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Total zero count - " << result1_example << std::endl;
 
         std::cout << "=== Part 2 (method 0x434C49434B) ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day1_part2(example_file);
         std::cout << "Total zero count - " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day1_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Total zero count - " << result1 << std::endl;
 
         std::cout << "=== Part 2 (method 0x434C49434B) ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day1_part2(input_file);
         std::cout << "Total zero count - " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -318,4 +528,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
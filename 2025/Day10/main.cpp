@@ -1,22 +1,35 @@
 #include <iostream>
-#include <fstream>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <sstream>
 #include <algorithm>
-#include <cmath>
-#include <chrono>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <numeric>
+#include <memory>
+#include <utility>
 #include <filesystem>
 #include <stdexcept>
 
+#include "../../common/input.hpp"
+#include "../../common/parse_cache.hpp"
+#include "../../common/solve.hpp"
+#include "../../common/stats.hpp"
+#include "../../common/thread_pool.hpp"
+
+namespace aoc2025::day10
+{
+
 /**
  * @struct Machine
  * @brief Represents a machine with indicator lights for Part 1.
  */
 struct Machine
 {
-    std::vector<int> target;               /// Target state of lights
-    std::vector<std::vector<int>> buttons; /// Each button's toggle pattern
+    int lights = 0;                      /// Number of indicator lights, at most 64
+    std::uint64_t target = 0;            /// Target state of lights, bit i = light i
+    std::vector<std::uint64_t> buttons;  /// Each button's toggle pattern as a light mask
 };
 
 /**
@@ -30,222 +43,270 @@ struct MachinePart2
 };
 
 /**
- * @brief Parse a line of input for Part 1.
+ * @struct InputData
+ * @brief Both views of every machine, filled from a single parse.
+ */
+struct InputData
+{
+    std::vector<Machine> machines;             /// Indicator-light view of each machine (Part 1)
+    std::vector<MachinePart2> joltageMachines; /// Joltage view of the same machines (Part 2)
+};
+
+/**
+ * @brief Parse a line of input into both machine views.
+ *
+ * The target lights, the joltage requirements and every button's index
+ * list are each read once; a button index sets a light bit and a counter
+ * entry at the same time.
  *
  * @param line Input line to parse
- * @return Machine structure
+ * @param data Receives one Machine and one MachinePart2
+ * @throws std::runtime_error if the machine has more than 64 lights
  */
-[[nodiscard]] Machine parse_line(const std::string &line)
+void parse_line(std::string_view line, InputData &data)
 {
     Machine machine;
+    MachinePart2 machinePart2;
 
     // Parse target state [.##.]
-    size_t start = line.find('[');
-    size_t end = line.find(']');
-    std::string targetStr = line.substr(start + 1, end - start - 1);
+    const size_t lightsStart = line.find('[');
+    const size_t lightsEnd = line.find(']');
+    const std::string_view targetStr = line.substr(lightsStart + 1, lightsEnd - lightsStart - 1);
 
-    for (char c : targetStr)
+    if (targetStr.size() > 64)
     {
-        machine.target.push_back(c == '#' ? 1 : 0);
+        throw std::runtime_error("Too many indicator lights: " + std::to_string(targetStr.size()));
     }
 
-    const int numLights = static_cast<int>(machine.target.size());
-
-    // Parse buttons (x,y,z)
-    size_t pos = end + 1;
-    while (pos < line.size())
+    machine.lights = static_cast<int>(targetStr.size());
+    for (int i = 0; i < machine.lights; i++)
     {
-        size_t openParen = line.find('(', pos);
-        if (openParen == std::string::npos)
-            break;
-
-        size_t closeParen = line.find(')', openParen);
-        if (closeParen == std::string::npos)
-            break;
-
-        // Check if this is the joltage requirements (after {)
-        size_t bracePos = line.find('{', pos);
-        if (bracePos != std::string::npos && openParen > bracePos)
-            break;
-
-        const std::string buttonStr = line.substr(openParen + 1, closeParen - openParen - 1);
-
-        std::vector<int> button(numLights, 0);
-        std::stringstream ss(buttonStr);
-        std::string num;
-
-        while (std::getline(ss, num, ','))
+        if (targetStr[i] == '#')
         {
-            const int idx = std::stoi(num);
-            if (idx < numLights)
-            {
-                button[idx] = 1;
-            }
+            machine.target |= std::uint64_t{1} << i;
         }
-
-        machine.buttons.push_back(button);
-        pos = closeParen + 1;
     }
 
-    return machine;
-}
-
-/**
- * @brief Parse a line of input for Part 2.
- *
- * @param line Input line to parse
- * @return MachinePart2 structure
- */
-[[nodiscard]] MachinePart2 parse_line_part2(const std::string &line)
-{
-    MachinePart2 machine;
-
-    // Parse joltage requirements {3,5,4,7}
-    size_t start = line.find('{');
-    size_t end = line.find('}');
-    std::string joltageStr = line.substr(start + 1, end - start - 1);
-
-    std::stringstream ss(joltageStr);
-    std::string num;
-    while (std::getline(ss, num, ','))
+    // Parse joltage requirements {3,5,4,7}; buttons come before them
+    const size_t joltageStart = line.find('{', lightsEnd);
+    if (joltageStart != std::string_view::npos)
     {
-        machine.joltageReq.push_back(std::stoi(num));
+        const size_t joltageEnd = line.find('}', joltageStart);
+        const std::string_view joltageStr = line.substr(joltageStart + 1, joltageEnd - joltageStart - 1);
+        for (const auto num : aoc::split(joltageStr, ','))
+        {
+            machinePart2.joltageReq.push_back(aoc::parse_int<int>(num));
+        }
     }
 
-    const int numCounters = static_cast<int>(machine.joltageReq.size());
+    const int numLights = machine.lights;
+    const int numCounters = static_cast<int>(machinePart2.joltageReq.size());
+    const size_t buttonsEnd = std::min(joltageStart, line.size());
 
     // Parse buttons (x,y,z)
-    size_t pos = line.find(']') + 1;
-    while (pos < start)
+    size_t pos = lightsEnd + 1;
+    while (pos < buttonsEnd)
     {
         size_t openParen = line.find('(', pos);
-        if (openParen == std::string::npos || openParen >= start)
+        if (openParen == std::string_view::npos || openParen >= buttonsEnd)
             break;
 
         size_t closeParen = line.find(')', openParen);
-        if (closeParen == std::string::npos)
+        if (closeParen == std::string_view::npos)
             break;
 
-        const std::string buttonStr = line.substr(openParen + 1, closeParen - openParen - 1);
+        const std::string_view buttonStr = line.substr(openParen + 1, closeParen - openParen - 1);
 
-        std::vector<int> button(numCounters, 0);
-        std::stringstream ss2(buttonStr);
-        std::string num2;
+        std::uint64_t button = 0;
+        std::vector<int> effect(numCounters, 0);
 
-        while (std::getline(ss2, num2, ','))
+        for (const auto num : aoc::split(buttonStr, ','))
         {
-            const int idx = std::stoi(num2);
-            if (idx < numCounters)
+            const int idx = aoc::parse_int<int>(num);
+            if (idx >= 0 && idx < numLights)
+            {
+                button |= std::uint64_t{1} << idx;
+            }
+            if (idx >= 0 && idx < numCounters)
             {
-                button[idx] = 1;
+                effect[idx] = 1;
             }
         }
 
         machine.buttons.push_back(button);
+        machinePart2.buttons.push_back(std::move(effect));
         pos = closeParen + 1;
     }
 
-    return machine;
+    data.machines.push_back(std::move(machine));
+    data.joltageMachines.push_back(std::move(machinePart2));
 }
 
 /**
- * @brief Read input data from file for Part 1.
+ * @brief Read input data from file for both parts.
  *
  * @param file_path Path to the input file
- * @return Vector of Machine structures
+ * @return Machines for Part 1 and Part 2
  * @throws std::runtime_error if the file doesn't exist or cannot be opened
  */
-[[nodiscard]] std::vector<Machine> read_input(const std::filesystem::path &file_path)
+[[nodiscard]] InputData parse_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
+    const aoc::MappedFile file(file_path);
 
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
+    InputData data;
+    data.machines.reserve(50);
+    data.joltageMachines.reserve(50);
 
-    std::vector<Machine> machines;
-    machines.reserve(50);
-
-    std::string line;
-    while (std::getline(file, line))
+    for (const auto line : aoc::lines(file.view()))
     {
         if (!line.empty())
         {
-            machines.push_back(parse_line(line));
+            parse_line(line, data);
         }
     }
 
-    machines.shrink_to_fit();
-    return machines;
+    data.machines.shrink_to_fit();
+    data.joltageMachines.shrink_to_fit();
+    return data;
 }
 
+/// Layout of InputData in the parse cache; bump when save() changes
+inline constexpr std::uint32_t kCacheSchema = 20251001;
+
 /**
- * @brief Read input data from file for Part 2.
- *
- * @param file_path Path to the input file
- * @return Vector of MachinePart2 structures
- * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ * @brief Serialize both machine views for the parse cache.
+ * @param writer Destination
+ * @param data Parsed machines
  */
-[[nodiscard]] std::vector<MachinePart2> read_input_part2(const std::filesystem::path &file_path)
+void save(aoc::BinaryWriter &writer, const InputData &data)
 {
-    if (!std::filesystem::exists(file_path))
+    writer.write<std::uint64_t>(data.machines.size());
+    for (const auto &machine : data.machines)
     {
-        throw std::runtime_error("File does not exist: " + file_path.string());
+        writer.write(machine.lights);
+        writer.write(machine.target);
+        writer.write_vector(machine.buttons);
     }
 
-    std::ifstream file(file_path);
-    if (!file.is_open())
+    writer.write<std::uint64_t>(data.joltageMachines.size());
+    for (const auto &machine : data.joltageMachines)
     {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
+        writer.write_vector(machine.joltageReq);
+        writer.write<std::uint64_t>(machine.buttons.size());
+        for (const auto &effect : machine.buttons)
+        {
+            writer.write_vector(effect);
+        }
     }
+}
 
-    std::vector<MachinePart2> machines;
-    machines.reserve(50);
+/**
+ * @brief Deserialize machines written by save().
+ *
+ * @param reader Source
+ * @param data Receives the machines
+ * @throws std::runtime_error if the data is truncated
+ */
+void load(aoc::BinaryReader &reader, InputData &data)
+{
+    data.machines.resize(reader.read<std::uint64_t>());
+    for (auto &machine : data.machines)
+    {
+        machine.lights = reader.read<int>();
+        machine.target = reader.read<std::uint64_t>();
+        machine.buttons = reader.read_vector<std::uint64_t>();
+    }
 
-    std::string line;
-    while (std::getline(file, line))
+    data.joltageMachines.resize(reader.read<std::uint64_t>());
+    for (auto &machine : data.joltageMachines)
     {
-        if (!line.empty())
+        machine.joltageReq = reader.read_vector<int>();
+        machine.buttons.resize(reader.read<std::uint64_t>());
+        for (auto &effect : machine.buttons)
         {
-            machines.push_back(parse_line_part2(line));
+            effect = reader.read_vector<int>();
         }
     }
+}
+
+/**
+ * @brief Read input data from file for both parts, through the parse cache when it is enabled.
+ *
+ * @param file_path Path to the input file
+ * @return Machines for Part 1 and Part 2
+ * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ */
+[[nodiscard]] InputData read_input(const std::filesystem::path &file_path)
+{
+    return aoc::parse_cache::load_or_parse<InputData>(file_path, kCacheSchema, parse_input);
+}
+
+/// Bits per packed GF(2) word
+constexpr int kWordBits = 64;
 
-    machines.shrink_to_fit();
-    return machines;
+/**
+ * @brief Test a bit in a packed GF(2) vector.
+ *
+ * @param words Packed words, bit i of the vector is bit i % 64 of word i / 64
+ * @param bit Bit index
+ * @return True if the bit is set
+ */
+[[nodiscard]] bool test_bit(const std::uint64_t *words, int bit) noexcept
+{
+    return (words[bit / kWordBits] >> (bit % kWordBits)) & 1U;
+}
+
+/**
+ * @brief Set a bit in a packed GF(2) vector.
+ *
+ * @param words Packed words
+ * @param bit Bit index
+ */
+void set_bit(std::uint64_t *words, int bit) noexcept
+{
+    words[bit / kWordBits] |= std::uint64_t{1} << (bit % kWordBits);
 }
 
 /**
  * @brief Solve system of linear equations over GF(2) using Gaussian elimination.
  *
- * Tries all combinations of free variables to find minimum presses.
+ * Each light is one equation, packed as a row of 64-bit words with one bit
+ * per button and the target bit after the last button, so eliminating a
+ * column is a handful of word XORs. Solutions are the particular solution
+ * plus any combination of the null-space basis; the combinations are
+ * visited in Gray-code order, so each step XORs a single basis vector and
+ * adjusts the press count incrementally.
  *
- * @param matrix Button toggle patterns
- * @param target Target state
+ * @param machine Machine with button light masks and target state
  * @return Minimum number of button presses, or -1 if no solution
  */
-int solveGF2(std::vector<std::vector<int>> &matrix, std::vector<int> &target)
+[[nodiscard]] int solveGF2(const Machine &machine)
 {
-    int rows = target.size();
-    int cols = matrix.size();
+    const int rows = machine.lights;
+    const int cols = static_cast<int>(machine.buttons.size());
 
     if (cols == 0)
         return -1;
 
-    // Create augmented matrix
-    std::vector<std::vector<int>> aug(rows, std::vector<int>(cols + 1));
+    // Create augmented matrix: buttons are columns, the target is column `cols`
+    const int rowWords = (cols + 1 + kWordBits - 1) / kWordBits;
+    std::vector<std::uint64_t> aug(static_cast<size_t>(rows) * rowWords, 0);
+    const auto row = [&](int i)
+    { return aug.data() + static_cast<size_t>(i) * rowWords; };
+
     for (int i = 0; i < rows; i++)
     {
         for (int j = 0; j < cols; j++)
         {
-            aug[i][j] = matrix[j][i]; // Transpose: buttons are columns
+            if ((machine.buttons[j] >> i) & 1U)
+            {
+                set_bit(row(i), j);
+            }
+        }
+        if ((machine.target >> i) & 1U)
+        {
+            set_bit(row(i), cols);
         }
-        aug[i][cols] = target[i];
     }
 
     // Keep track of pivot columns
@@ -258,11 +319,11 @@ int solveGF2(std::vector<std::vector<int>> &matrix, std::vector<int> &target)
     {
         // Find pivot
         int pivotRow = -1;
-        for (int row = pivot; row < rows; row++)
+        for (int r = pivot; r < rows; r++)
         {
-            if (aug[row][col] == 1)
+            if (test_bit(row(r), col))
             {
-                pivotRow = row;
+                pivotRow = r;
                 break;
             }
         }
@@ -273,20 +334,22 @@ int solveGF2(std::vector<std::vector<int>> &matrix, std::vector<int> &target)
         // Swap rows
         if (pivotRow != pivot)
         {
-            std::swap(aug[pivot], aug[pivotRow]);
+            std::swap_ranges(row(pivot), row(pivot) + rowWords, row(pivotRow));
         }
 
         pivotCol[pivot] = col;
         isPivotCol[col] = true;
 
         // Eliminate
-        for (int row = 0; row < rows; row++)
+        const std::uint64_t *pivotWords = row(pivot);
+        for (int r = 0; r < rows; r++)
         {
-            if (row != pivot && aug[row][col] == 1)
+            if (r != pivot && test_bit(row(r), col))
             {
-                for (int c = 0; c <= cols; c++)
+                std::uint64_t *words = row(r);
+                for (int w = 0; w < rowWords; w++)
                 {
-                    aug[row][c] ^= aug[pivot][c]; // XOR for GF(2)
+                    words[w] ^= pivotWords[w]; // XOR for GF(2)
                 }
             }
         }
@@ -294,9 +357,9 @@ int solveGF2(std::vector<std::vector<int>> &matrix, std::vector<int> &target)
     }
 
     // Check for inconsistency
-    for (int row = pivot; row < rows; row++)
+    for (int r = pivot; r < rows; r++)
     {
-        if (aug[row][cols] == 1)
+        if (test_bit(row(r), cols))
         {
             return -1; // No solution
         }
@@ -312,42 +375,54 @@ int solveGF2(std::vector<std::vector<int>> &matrix, std::vector<int> &target)
         }
     }
 
-    // Try all combinations of free variables
-    int minPresses = cols + 1;
-    int numFree = freeVars.size();
-
-    for (int mask = 0; mask < (1 << numFree); mask++)
+    const int numFree = static_cast<int>(freeVars.size());
+    if (numFree >= kWordBits - 1)
     {
-        std::vector<int> solution(cols, 0);
+        throw std::runtime_error("Too many free buttons to enumerate: " + std::to_string(numFree));
+    }
 
-        // Set free variables
-        for (int i = 0; i < numFree; i++)
+    // Particular solution (all free variables zero) and one null-space vector per free variable
+    const int solutionWords = (cols + kWordBits - 1) / kWordBits;
+    std::vector<std::uint64_t> solution(solutionWords, 0);
+    std::vector<std::uint64_t> basis(static_cast<size_t>(numFree) * solutionWords, 0);
+    for (int r = 0; r < pivot; r++)
+    {
+        if (test_bit(row(r), cols))
         {
-            solution[freeVars[i]] = (mask >> i) & 1;
+            set_bit(solution.data(), pivotCol[r]);
         }
-
-        // Back substitution for pivot variables
-        for (int row = pivot - 1; row >= 0; row--)
+    }
+    for (int k = 0; k < numFree; k++)
+    {
+        std::uint64_t *vector = basis.data() + static_cast<size_t>(k) * solutionWords;
+        set_bit(vector, freeVars[k]);
+        for (int r = 0; r < pivot; r++)
         {
-            int col = pivotCol[row];
-            if (col == -1)
-                continue;
-
-            int val = aug[row][cols];
-            for (int c = col + 1; c < cols; c++)
+            if (test_bit(row(r), freeVars[k]))
             {
-                val ^= (aug[row][c] * solution[c]);
+                set_bit(vector, pivotCol[r]);
             }
-            solution[col] = val;
         }
+    }
+
+    // Walk all free-variable combinations in Gray-code order
+    int count = 0;
+    for (const std::uint64_t word : solution)
+    {
+        count += std::popcount(word);
+    }
+    int minPresses = count;
 
-        // Count presses
-        int count = 0;
-        for (int val : solution)
+    for (std::uint64_t step = 1; step < (std::uint64_t{1} << numFree); step++)
+    {
+        const int k = std::countr_zero(step);
+        const std::uint64_t *vector = basis.data() + static_cast<size_t>(k) * solutionWords;
+        for (int w = 0; w < solutionWords; w++)
         {
-            count += val;
+            // Bits of the vector that were set get cleared and vice versa
+            count += std::popcount(vector[w]) - 2 * std::popcount(vector[w] & solution[w]);
+            solution[w] ^= vector[w];
         }
-
         minPresses = std::min(minPresses, count);
     }
 
@@ -362,10 +437,7 @@ int solveGF2(std::vector<std::vector<int>> &matrix, std::vector<int> &target)
  */
 [[nodiscard]] int solveMachine(const Machine &machine)
 {
-    std::vector<std::vector<int>> buttons = machine.buttons;
-    std::vector<int> target = machine.target;
-
-    return solveGF2(buttons, target);
+    return solveGF2(machine);
 }
 
 /**
@@ -373,13 +445,13 @@ int solveGF2(std::vector<std::vector<int>> &matrix, std::vector<int> &target)
  *
  * Solves all machines and calculates total button presses needed.
  *
- * @param file_path Path to the input file
+ * @param data Parsed machines
  * @return Total minimum button presses
- * @throws std::runtime_error if the file cannot be read or no solution found
+ * @throws std::runtime_error if no solution is found
  */
-[[nodiscard]] int advent_of_code_2025_day10_part1(const std::filesystem::path &file_path)
+[[nodiscard]] int advent_of_code_2025_day10_part1(const InputData &data)
 {
-    const auto machines = read_input(file_path);
+    const std::vector<Machine> &machines = data.machines;
     int totalPresses = 0;
 
     for (size_t i = 0; i < machines.size(); i++)
@@ -398,147 +470,374 @@ int solveGF2(std::vector<std::vector<int>> &matrix, std::vector<int> &target)
     return totalPresses;
 }
 
-// Improved backtracking solver with better pruning and constraint propagation
-bool backtrackOptimized(const std::vector<std::vector<int>> &A, const std::vector<int> &b, std::vector<long long> &x,
-                        std::vector<long long> &remaining, int buttonIdx, long long currentCost, long long &bestCost)
+/**
+ * @brief Solve Advent of Code 2025 Day 10 Part 1 from an input file.
+ *
+ * @param file_path Path to the input file
+ * @return Total minimum button presses
+ * @throws std::runtime_error if the file cannot be read or no solution found
+ */
+[[nodiscard]] int advent_of_code_2025_day10_part1(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day10_part1(read_input(file_path));
+}
+
+/**
+ * @struct IntegerSystem
+ * @brief Button equations A*x = b reduced to pivot rows over the integers.
+ *
+ * Each pivot row r reads pivot[r] * x_pivot + sum_k freeColumns[k][r] * x_free_k = rhs[r],
+ * so once the free variables are fixed every pivot variable follows directly.
+ */
+struct IntegerSystem
 {
-    int numButtons = A.size();
-    int numCounters = b.size();
+    bool consistent = true;                       /// False if the equations have no rational solution
+    std::vector<long long> pivot;                 /// Positive pivot coefficient per row
+    std::vector<long long> rhs;                   /// Right-hand side per row
+    std::vector<std::vector<long long>> freeColumns; /// Coefficients of each free variable per row
+    std::vector<long long> freeBound;             /// Upper bound on presses of each free variable
+};
 
-    // Prune if current cost already exceeds best
-    if (currentCost >= bestCost)
-        return false;
+/**
+ * @brief Reduce the button equations with fraction-free Gaussian elimination.
+ *
+ * Same structure as solveGF2, but over the integers: eliminating a column
+ * cross-multiplies rows and divides them by the gcd of their entries, so all
+ * arithmetic stays exact and small. A free button can never be pressed more
+ * often than the smallest requirement it touches, which bounds its search.
+ *
+ * @param A Button effect matrix
+ * @param b Joltage requirements
+ * @return Reduced system
+ */
+[[nodiscard]] IntegerSystem reduce_system(const std::vector<std::vector<int>> &A, const std::vector<int> &b)
+{
+    const int rows = static_cast<int>(b.size());
+    const int cols = static_cast<int>(A.size());
 
-    // Base case: all buttons assigned
-    if (buttonIdx == numButtons)
+    // Create augmented matrix
+    std::vector<std::vector<long long>> aug(rows, std::vector<long long>(cols + 1));
+    for (int i = 0; i < rows; i++)
     {
-        // Check if all counters are satisfied
-        for (int i = 0; i < numCounters; i++)
+        for (int j = 0; j < cols; j++)
         {
-            if (remaining[i] != 0)
-                return false;
+            aug[i][j] = A[j][i]; // Transpose: buttons are columns
         }
-        bestCost = currentCost;
-        return true;
+        aug[i][cols] = b[i];
     }
 
-    // Calculate smart bound for current button
-    long long maxNeeded = 0;
-    bool affectsAny = false;
+    // Keep track of pivot columns
+    std::vector<int> pivotCol(rows, -1);
+    std::vector<bool> isPivotCol(cols, false);
 
-    for (int i = 0; i < numCounters; i++)
+    int pivot = 0;
+    for (int col = 0; col < cols && pivot < rows; col++)
     {
-        if (A[buttonIdx][i] == 1 && remaining[i] > 0)
+        int pivotRow = -1;
+        for (int row = pivot; row < rows; row++)
+        {
+            if (aug[row][col] != 0)
+            {
+                pivotRow = row;
+                break;
+            }
+        }
+
+        if (pivotRow == -1)
+            continue;
+
+        if (pivotRow != pivot)
+        {
+            std::swap(aug[pivot], aug[pivotRow]);
+        }
+
+        pivotCol[pivot] = col;
+        isPivotCol[col] = true;
+
+        const long long p = aug[pivot][col];
+        for (int row = 0; row < rows; row++)
         {
-            affectsAny = true;
-            maxNeeded = std::max(maxNeeded, remaining[i]);
+            const long long factor = aug[row][col];
+            if (row == pivot || factor == 0)
+                continue;
+
+            long long divisor = 0;
+            for (int c = 0; c <= cols; c++)
+            {
+                aug[row][c] = aug[row][c] * p - aug[pivot][c] * factor;
+                divisor = std::gcd(divisor, aug[row][c]);
+            }
+            if (divisor > 1)
+            {
+                for (int c = 0; c <= cols; c++)
+                {
+                    aug[row][c] /= divisor;
+                }
+            }
         }
+        pivot++;
     }
 
-    // If this button doesn't help with any remaining requirement, skip it
-    if (!affectsAny)
+    IntegerSystem system;
+
+    // Check for inconsistency
+    for (int row = pivot; row < rows; row++)
     {
-        x[buttonIdx] = 0;
-        return backtrackOptimized(A, b, x, remaining, buttonIdx + 1, currentCost, bestCost);
+        if (aug[row][cols] != 0)
+        {
+            system.consistent = false;
+            return system;
+        }
     }
 
-    // Try values from 0 to maxNeeded (but not more than bestCost - currentCost)
-    long long maxTries = std::min(maxNeeded, bestCost - currentCost - 1);
+    for (int row = 0; row < pivot; row++)
+    {
+        const long long sign = aug[row][pivotCol[row]] < 0 ? -1 : 1;
+        system.pivot.push_back(sign * aug[row][pivotCol[row]]);
+        system.rhs.push_back(sign * aug[row][cols]);
+    }
 
-    // Try in reverse order (greedy: try larger values first for this button)
-    for (long long val = maxTries; val >= 0; val--)
+    for (int col = 0; col < cols; col++)
     {
-        x[buttonIdx] = val;
+        if (isPivotCol[col])
+            continue;
 
-        // Update remaining counters
-        std::vector<long long> newRemaining = remaining;
-        bool valid = true;
+        std::vector<long long> column(pivot);
+        for (int row = 0; row < pivot; row++)
+        {
+            const long long sign = aug[row][pivotCol[row]] < 0 ? -1 : 1;
+            column[row] = sign * aug[row][col];
+        }
+        system.freeColumns.push_back(std::move(column));
 
-        for (int i = 0; i < numCounters; i++)
+        long long bound = 0;
+        bool touchesAny = false;
+        for (int i = 0; i < rows; i++)
         {
-            if (A[buttonIdx][i] == 1)
+            if (A[col][i] == 1)
             {
-                newRemaining[i] -= val;
-                // If we go negative, this assignment is invalid
-                if (newRemaining[i] < 0)
-                {
-                    valid = false;
-                    break;
-                }
+                bound = touchesAny ? std::min<long long>(bound, b[i]) : b[i];
+                touchesAny = true;
             }
         }
+        system.freeBound.push_back(bound); // a button touching nothing is never worth pressing
+    }
+
+    return system;
+}
 
-        if (valid)
+/**
+ * @struct PressSearch
+ * @brief State shared by every task searching one machine's free variables.
+ */
+struct PressSearch
+{
+    const IntegerSystem &system;     /// Reduced equations of the machine
+    std::atomic<long long> bestCost; /// Cheapest complete solution found so far
+    aoc::stats::Counters stats;      /// Search counters, empty unless built with AOC_STATS
+
+    /**
+     * @brief Record a complete solution if it beats the current best.
+     *
+     * @param cost Total presses of the solution
+     */
+    void offer(long long cost) noexcept
+    {
+        long long best = bestCost.load(std::memory_order_relaxed);
+        while (cost < best && !bestCost.compare_exchange_weak(best, cost, std::memory_order_relaxed))
         {
-            backtrackOptimized(A, b, x, newRemaining, buttonIdx + 1, currentCost + val, bestCost);
         }
     }
+};
 
-    x[buttonIdx] = 0;
-    return bestCost < LLONG_MAX;
-}
+/// Free-variable levels whose values become separate pool tasks
+constexpr int kSplitLevels = 1;
 
 /**
- * @brief Solve integer linear programming problem.
+ * @brief Subtract presses of a free variable from the pivot row residuals.
  *
- * @param A Button effect matrix
- * @param b Joltage requirements
- * @return Minimum cost, or -1 if no solution
+ * @param column Coefficients of the free variable per pivot row
+ * @param residual Right-hand sides still to be covered, updated in place
+ * @param presses Presses to apply; negative to undo
  */
-[[nodiscard]] long long solveIntegerLinear(const std::vector<std::vector<int>> &A, const std::vector<int> &b)
+void apply_presses(const std::vector<long long> &column, std::vector<long long> &residual, long long presses) noexcept
 {
-    int numButtons = A.size();
-    int numCounters = b.size();
+    for (size_t r = 0; r < residual.size(); r++)
+    {
+        residual[r] -= column[r] * presses;
+    }
+}
 
-    if (numButtons == 0)
-        return -1;
+/**
+ * @brief Complete a free-variable assignment by solving for the pivot variables.
+ *
+ * @param search Shared search state
+ * @param residual Pivot row residuals after all free variables are fixed
+ * @param freeCost Presses spent on free variables
+ */
+void finish_assignment(PressSearch &search, const std::vector<long long> &residual, long long freeCost) noexcept
+{
+    long long cost = freeCost;
+    for (size_t r = 0; r < residual.size(); r++)
+    {
+        const long long p = search.system.pivot[r];
+        if (residual[r] < 0 || residual[r] % p != 0)
+        {
+            if (residual[r] < 0)
+            {
+                search.stats.add(aoc::stats::Counter::PrunedByNegative);
+            }
+            return; // pivot presses would be negative or fractional
+        }
+        cost += residual[r] / p;
+    }
+    search.offer(cost);
+}
 
-    // Initialize solution vector
-    std::vector<long long> x(numButtons, 0);
+/**
+ * @brief Depth-first enumeration of the free variables within their bounds.
+ *
+ * Values are tried in increasing order, so a level stops as soon as the
+ * free presses alone reach the best known cost. Residuals are updated in
+ * place and restored on return.
+ *
+ * @param search Shared search state with the atomic best bound
+ * @param residual Pivot row residuals, restored on return
+ * @param freeIdx Next free variable to assign
+ * @param currentCost Presses spent on free variables so far
+ */
+void enumerate_free(PressSearch &search, std::vector<long long> &residual, int freeIdx, long long currentCost)
+{
+    const IntegerSystem &system = search.system;
+    search.stats.add(aoc::stats::Counter::NodesExpanded);
+    search.stats.depth(freeIdx);
+    if (freeIdx == static_cast<int>(system.freeColumns.size()))
+    {
+        finish_assignment(search, residual, currentCost);
+        return;
+    }
 
-    // Initialize remaining requirements (what still needs to be satisfied)
-    std::vector<long long> remaining(numCounters);
-    for (int i = 0; i < numCounters; i++)
+    const auto &column = system.freeColumns[freeIdx];
+    long long val = 0;
+    for (; val <= system.freeBound[freeIdx]; val++)
     {
-        remaining[i] = b[i];
+        if (currentCost + val >= search.bestCost.load(std::memory_order_relaxed))
+        {
+            search.stats.add(aoc::stats::Counter::PrunedByCost);
+            break;
+        }
+
+        enumerate_free(search, residual, freeIdx + 1, currentCost + val);
+        apply_presses(column, residual, 1);
     }
+    apply_presses(column, residual, -val);
+}
 
-    // Calculate initial upper bound
-    long long bestCost = 0;
-    for (int i = 0; i < numCounters; i++)
+/**
+ * @brief Enumerate a subtree, splitting the top levels into pool tasks.
+ *
+ * For the first kSplitLevels free variables every value becomes its own
+ * task with a private copy of the residuals; deeper levels run
+ * sequentially inside the task.
+ *
+ * @param pool Pool to submit subtasks to
+ * @param search Shared search state
+ * @param residual Pivot row residuals, owned by this task
+ * @param freeIdx Next free variable to assign
+ * @param currentCost Presses spent on free variables so far
+ */
+void spawn_search(aoc::ThreadPool &pool, PressSearch &search, std::vector<long long> residual, int freeIdx,
+                  long long currentCost)
+{
+    const IntegerSystem &system = search.system;
+    if (freeIdx >= kSplitLevels || freeIdx == static_cast<int>(system.freeColumns.size()))
     {
-        bestCost += b[i];
+        const aoc::stats::Stopwatch timer(search.stats);
+        enumerate_free(search, residual, freeIdx, currentCost);
+        return;
     }
 
-    // Run optimized backtracking
-    if (backtrackOptimized(A, b, x, remaining, 0, 0, bestCost))
+    for (long long val = 0; val <= system.freeBound[freeIdx]; val++)
     {
-        return bestCost;
+        std::vector<long long> next = residual;
+        apply_presses(system.freeColumns[freeIdx], next, val);
+        pool.submit([&pool, &search, next = std::move(next), freeIdx, cost = currentCost + val]() mutable
+                    {
+                        if (cost < search.bestCost.load(std::memory_order_relaxed))
+                        {
+                            spawn_search(pool, search, std::move(next), freeIdx + 1, cost);
+                        }
+                        else
+                        {
+                            search.stats.add(aoc::stats::Counter::PrunedByCost);
+                        } });
     }
+}
 
-    return -1;
+/**
+ * @brief Initial bound on the presses of a machine.
+ *
+ * Every press raises at least one counter by one, so no solution needs more
+ * presses than the sum of the requirements.
+ *
+ * @param b Joltage requirements
+ * @return One above the largest possible minimum
+ */
+[[nodiscard]] long long unreachable_cost(const std::vector<int> &b) noexcept
+{
+    long long total = 0;
+    for (const int req : b)
+    {
+        total += req;
+    }
+    return total + 1;
 }
 
 /**
  * @brief Solve Advent of Code 2025 Day 10 Part 2.
  *
- * Solves all machines using integer linear programming.
+ * Reduces every machine's equations, then enumerates all free variables
+ * concurrently on a thread pool. Each machine's first free variable is
+ * split into tasks that share the machine's atomic best bound, so a few
+ * machines with large search spaces still use every worker.
  *
- * @param file_path Path to the input file
+ * @param data Parsed machines
  * @return Total minimum button presses
- * @throws std::runtime_error if the file cannot be read or no solution found
+ * @throws std::runtime_error if no solution is found
  */
-[[nodiscard]] long long advent_of_code_2025_day10_part2(const std::filesystem::path &file_path)
+[[nodiscard]] long long advent_of_code_2025_day10_part2(const InputData &data)
 {
-    const auto machines = read_input_part2(file_path);
-    long long totalPresses = 0;
+    const std::vector<MachinePart2> &machines = data.joltageMachines;
+    std::vector<IntegerSystem> systems;
+    systems.reserve(machines.size());
+    for (size_t i = 0; i < machines.size(); i++)
+    {
+        systems.push_back(reduce_system(machines[i].buttons, machines[i].joltageReq));
+        if (machines[i].buttons.empty() || !systems.back().consistent)
+        {
+            throw std::runtime_error("No solution found for machine " + std::to_string(i + 1));
+        }
+    }
 
+    std::vector<std::unique_ptr<PressSearch>> searches;
+    searches.reserve(machines.size());
+
+    aoc::ThreadPool pool;
     for (size_t i = 0; i < machines.size(); i++)
     {
-        const MachinePart2 &machine = machines[i];
-        long long presses = solveIntegerLinear(machine.buttons, machine.joltageReq);
+        searches.push_back(std::unique_ptr<PressSearch>(
+            new PressSearch{systems[i], unreachable_cost(machines[i].joltageReq), {}}));
+        pool.submit([&pool, search = searches.back().get()]
+                    { spawn_search(pool, *search, search->system.rhs, 0, 0); });
+    }
+    pool.wait();
 
-        if (presses == -1)
+    long long totalPresses = 0;
+    for (size_t i = 0; i < machines.size(); i++)
+    {
+        aoc::stats::record("machine", i + 1, searches[i]->stats);
+        const long long presses = searches[i]->bestCost.load();
+        if (presses == unreachable_cost(machines[i].joltageReq))
         {
             throw std::runtime_error("No solution found for machine " + std::to_string(i + 1));
         }
@@ -549,6 +848,40 @@ bool backtrackOptimized(const std::vector<std::vector<int>> &A, const std::vecto
     return totalPresses;
 }
 
+/**
+ * @brief Solve Advent of Code 2025 Day 10 Part 2 from an input file.
+ *
+ * @param file_path Path to the input file
+ * @return Total minimum button presses
+ * @throws std::runtime_error if the file cannot be read or no solution found
+ */
+[[nodiscard]] long long advent_of_code_2025_day10_part2(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day10_part2(read_input(file_path));
+}
+
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 10 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day10_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day10_part2(input); });
+}
+
+} // namespace aoc2025::day10
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -558,6 +891,8 @@ bool backtrackOptimized(const std::vector<std::vector<int>> &A, const std::vecto
  */
 int main()
 {
+    using namespace aoc2025::day10;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -565,18 +900,20 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day10_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Total minimum button presses: " << result1_example << std::endl;
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day10_part2(example_file);
         std::cout << "Total minimum button presses: " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day10_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Total minimum button presses: " << result1 << std::endl;
+
+        std::cout << "=== Part 2 ===" << std::endl;
+        std::cout << "Total minimum button presses: " << result2 << std::endl;
     }
     catch (const std::exception &e)
     {
@@ -585,4 +922,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
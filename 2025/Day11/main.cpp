@@ -1,91 +1,109 @@
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <map>
-#include <tuple>
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <stdexcept>
+#include <utility>
+
+#include "../../common/graph.hpp"
+#include "../../common/input.hpp"
+#include "../../common/parse_cache.hpp"
+#include "../../common/solve.hpp"
+#include "../../common/stats.hpp"
+
+namespace aoc2025::day11
+{
 
 /**
  * @brief Read and parse input graph from file.
  *
+ * Device names are interned to dense ids and the outputs are packed into
+ * CSR adjacency arrays.
+ *
  * @param file_path Path to the input file
- * @return Map representing the graph (device -> list of outputs)
+ * @return Graph of devices (device -> list of outputs)
  * @throws std::runtime_error if the file doesn't exist or cannot be opened
  */
-[[nodiscard]] std::map<std::string, std::vector<std::string>> read_input(const std::filesystem::path &file_path)
+[[nodiscard]] aoc::Digraph parse_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
+    const aoc::MappedFile file(file_path);
 
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
-
-    std::map<std::string, std::vector<std::string>> graph;
-    std::string line;
+    aoc::Digraph::Builder builder;
 
-    while (std::getline(file, line))
+    for (const auto line : aoc::lines(file.view()))
     {
         size_t colonPos = line.find(':');
-        if (colonPos == std::string::npos)
+        if (colonPos == std::string_view::npos)
             continue;
 
-        std::string device = line.substr(0, colonPos);
-        std::string outputs = line.substr(colonPos + 2);
-
-        std::stringstream ss(outputs);
-        std::string output;
-        std::vector<std::string> outputList;
-
-        while (ss >> output)
+        const int device = builder.intern(line.substr(0, colonPos));
+        for (const auto output : aoc::words(line.substr(colonPos + 1)))
         {
-            outputList.push_back(output);
+            builder.add_edge(device, builder.intern(output));
         }
-
-        graph[device] = outputList;
     }
 
-    return graph;
+    return std::move(builder).build();
+}
+
+/// Layout of the graph in the parse cache; bump when Digraph's save() changes
+inline constexpr std::uint32_t kCacheSchema = 20251101;
+
+/**
+ * @brief Read the input graph, through the parse cache when it is enabled.
+ *
+ * @param file_path Path to the input file
+ * @return Graph of devices (device -> list of outputs)
+ * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ */
+[[nodiscard]] aoc::Digraph read_input(const std::filesystem::path &file_path)
+{
+    return aoc::parse_cache::load_or_parse<aoc::Digraph>(file_path, kCacheSchema, parse_input);
 }
 
 /**
- * @brief Count all paths from current node to target node in graph.
+ * @brief Count all paths from source node to target node in graph.
+ *
+ * A single iterative DP in reverse topological order: every reachable node
+ * is evaluated once, after all of its outputs.
  *
- * @param current Current node
- * @param target Target node
  * @param graph Graph representation
- * @return Number of paths from current to target
+ * @param source Start node name
+ * @param target Target node name
+ * @return Number of paths from source to target
+ * @throws std::runtime_error if a cycle is reachable from the source
  */
-[[nodiscard]] int count_paths(const std::string &current, const std::string &target,
-                              const std::map<std::string, std::vector<std::string>> &graph)
+[[nodiscard]] long long count_paths(const aoc::Digraph &graph, std::string_view source, std::string_view target)
 {
-    // Jeśli dotarliśmy do celu, znaleźliśmy jedną ścieżkę
-    if (current == target)
+    if (source == target)
     {
         return 1;
     }
 
-    // Jeśli węzeł nie ma wyjść, nie ma ścieżki
-    if (graph.find(current) == graph.end())
+    const int src = graph.find(source);
+    const int dst = graph.find(target);
+    if (src == aoc::Digraph::kNoNode || dst == aoc::Digraph::kNoNode)
     {
         return 0;
     }
 
-    // Zliczamy ścieżki przez wszystkie wyjścia
-    int totalPaths = 0;
-    for (const auto &next : graph.at(current))
-    {
-        totalPaths += count_paths(next, target, graph);
-    }
+    std::vector<long long> paths(graph.node_count(), 0);
+    graph.post_order_from(src, [&](int node)
+                          {
+                              if (node == dst)
+                              {
+                                  paths[node] = 1;
+                                  return;
+                              }
+                              for (const int next : graph.successors(node))
+                              {
+                                  paths[node] += paths[next];
+                              } });
 
-    return totalPaths;
+    return paths[src];
 }
 
 /**
@@ -93,88 +111,236 @@
  *
  * Counts all paths from 'you' to 'out' in the network graph.
  *
+ * @param graph Graph representation
+ * @return Number of paths from 'you' to 'out'
+ */
+[[nodiscard]] long long advent_of_code_2025_day11_part1(const aoc::Digraph &graph)
+{
+    return count_paths(graph, "you", "out");
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 11 Part 1 from an input file.
+ *
  * @param file_path Path to the input file
  * @return Number of paths from 'you' to 'out'
  * @throws std::runtime_error if the file cannot be read
  */
-[[nodiscard]] int advent_of_code_2025_day11_part1(const std::filesystem::path &file_path)
+[[nodiscard]] long long advent_of_code_2025_day11_part1(const std::filesystem::path &file_path)
 {
-    const auto graph = read_input(file_path);
-    const int pathCount = count_paths("you", "out", graph);
-    return pathCount;
+    return advent_of_code_2025_day11_part1(read_input(file_path));
 }
 
 /**
- * @brief Count paths from current to target that visit specific required nodes.
- *
- * Uses memoization to efficiently count paths that must visit both 'dac' and 'fft'.
+ * @class PathCounter
+ * @brief Answers "paths from A to B through a set of waypoints" queries on one graph.
  *
- * @param current Current node
- * @param target Target node
- * @param visitedDac Whether 'dac' has been visited
- * @param visitedFft Whether 'fft' has been visited
- * @param graph Graph representation
- * @param memo Memoization cache
- * @return Number of valid paths
+ * Up to 16 waypoints are registered once, and every query selects the
+ * required ones with a bitmask. In a DAG a path meets its waypoints in
+ * topological order, so a query is the product of segment counts between
+ * consecutive required nodes sorted by topological rank. Segment counts
+ * come from per-source forward DP vectors that are computed on first use
+ * and reused by every later query from the same node.
  */
-[[nodiscard]] long long count_paths_with_nodes(const std::string &current, const std::string &target,
-                                               bool visitedDac, bool visitedFft,
-                                               const std::map<std::string, std::vector<std::string>> &graph,
-                                               std::map<std::tuple<std::string, bool, bool>, long long> &memo)
+class PathCounter
 {
-    // Jeśli dotarliśmy do celu
-    if (current == target)
+public:
+    /// Largest number of waypoints a query mask can refer to
+    static constexpr std::size_t kMaxWaypoints = 16;
+
+    /**
+     * @brief Prepare the counter for a graph.
+     *
+     * @param graph Graph to query; must outlive the counter
+     * @param waypoints Names of the nodes that query masks refer to, bit i = waypoints[i]
+     * @throws std::runtime_error if there are too many waypoints or the graph has a cycle
+     */
+    PathCounter(const aoc::Digraph &graph, const std::vector<std::string_view> &waypoints)
+        : graph_(graph), rank_(graph.node_count()), fromSource_(graph.node_count())
     {
-        // Zwróć 1 tylko jeśli odwiedziliśmy oba wymagane węzły
-        return (visitedDac && visitedFft) ? 1 : 0;
+        if (waypoints.size() > kMaxWaypoints)
+        {
+            throw std::runtime_error("Too many waypoints: " + std::to_string(waypoints.size()));
+        }
+        for (const auto name : waypoints)
+        {
+            waypoints_.push_back(graph.find(name));
+        }
+
+        order_ = graph.topological_order();
+        for (int i = 0; i < static_cast<int>(order_.size()); i++)
+        {
+            rank_[order_[i]] = i;
+        }
     }
 
-    // Sprawdź memoizację
-    auto key = std::make_tuple(current, visitedDac, visitedFft);
-    if (memo.find(key) != memo.end())
+    /**
+     * @brief Get the cache counters of the queries so far.
+     * @return Hits and misses of the per-source DP cache; zero unless built with AOC_STATS
+     */
+    [[nodiscard]] const aoc::stats::Counters &stats() const noexcept { return stats_; }
+
+    /**
+     * @brief Count paths from source to target that visit every required waypoint.
+     *
+     * @param source Start node name
+     * @param target Target node name
+     * @param required Bitmask over the registered waypoints
+     * @return Number of paths
+     */
+    [[nodiscard]] long long count(std::string_view source, std::string_view target, std::uint16_t required)
     {
-        return memo[key];
+        return count(graph_.find(source), graph_.find(target), required);
     }
 
-    // Jeśli węzeł nie ma wyjść
-    if (graph.find(current) == graph.end())
+    /**
+     * @brief Count paths between node ids that visit every required waypoint.
+     *
+     * @param source Start node id, or kNoNode
+     * @param target Target node id, or kNoNode
+     * @param required Bitmask over the registered waypoints
+     * @return Number of paths; 0 if any involved node is missing from the graph
+     */
+    [[nodiscard]] long long count(int source, int target, std::uint16_t required)
     {
-        memo[key] = 0;
-        return 0;
+        if (source == aoc::Digraph::kNoNode || target == aoc::Digraph::kNoNode)
+        {
+            return 0;
+        }
+
+        std::vector<int> stops;
+        for (std::size_t i = 0; i < waypoints_.size(); i++)
+        {
+            if ((required >> i) & 1U)
+            {
+                if (waypoints_[i] == aoc::Digraph::kNoNode)
+                {
+                    return 0;
+                }
+                stops.push_back(waypoints_[i]);
+            }
+        }
+        std::sort(stops.begin(), stops.end(), [&](int a, int b)
+                  { return rank_[a] < rank_[b]; });
+        stops.push_back(target);
+
+        long long total = 1;
+        int from = source;
+        for (const int to : stops)
+        {
+            total *= segment(from, to);
+            if (total == 0)
+            {
+                break;
+            }
+            from = to;
+        }
+        return total;
     }
 
-    // Zliczamy ścieżki przez wszystkie wyjścia
-    long long totalPaths = 0;
-    for (const auto &next : graph.at(current))
+private:
+    /**
+     * @brief Number of paths from one node to another.
+     *
+     * @param from Start node id
+     * @param to End node id
+     * @return Paths from `from` to `to`; 1 if they are the same node
+     */
+    [[nodiscard]] long long segment(int from, int to)
     {
-        const bool newVisitedDac = visitedDac || (next == "dac");
-        const bool newVisitedFft = visitedFft || (next == "fft");
-        totalPaths += count_paths_with_nodes(next, target, newVisitedDac, newVisitedFft, graph, memo);
+        if (from == to)
+        {
+            return 1;
+        }
+        if (rank_[to] < rank_[from])
+        {
+            return 0;
+        }
+
+        auto &paths = fromSource_[from];
+        if (!paths.empty())
+        {
+            stats_.add(aoc::stats::Counter::MemoHits);
+        }
+        else
+        {
+            stats_.add(aoc::stats::Counter::MemoMisses);
+            // Forward DP over the nodes that can follow `from` in topological order
+            paths.assign(graph_.node_count(), 0);
+            paths[from] = 1;
+            for (int i = rank_[from]; i < static_cast<int>(order_.size()); i++)
+            {
+                const int node = order_[i];
+                if (paths[node] == 0)
+                    continue;
+
+                for (const int next : graph_.successors(node))
+                {
+                    paths[next] += paths[node];
+                }
+            }
+        }
+        return paths[to];
     }
 
-    memo[key] = totalPaths;
-    return totalPaths;
-}
+    const aoc::Digraph &graph_;                   ///< Queried graph
+    std::vector<int> waypoints_;                  ///< Node id per mask bit, kNoNode if absent
+    std::vector<int> order_;                      ///< Nodes in topological order
+    std::vector<int> rank_;                       ///< Position of each node in order_
+    std::vector<std::vector<long long>> fromSource_; ///< Cached path counts per source, empty until used
+    aoc::stats::Counters stats_;                  ///< Cache hits and misses of segment()
+};
 
 /**
  * @brief Solve Advent of Code 2025 Day 11 Part 2.
  *
  * Counts paths from 'svr' to 'out' that visit both 'dac' and 'fft'.
  *
+ * @param graph Graph representation
+ * @return Number of valid paths from 'svr' to 'out' through 'dac' and 'fft'
+ */
+[[nodiscard]] long long advent_of_code_2025_day11_part2(const aoc::Digraph &graph)
+{
+    PathCounter counter(graph, {"dac", "fft"});
+    const long long paths = counter.count("svr", "out", 0b11);
+    aoc::stats::record("query", 1, counter.stats());
+    return paths;
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 11 Part 2 from an input file.
+ *
  * @param file_path Path to the input file
  * @return Number of valid paths from 'svr' to 'out' through 'dac' and 'fft'
  * @throws std::runtime_error if the file cannot be read
  */
 [[nodiscard]] long long advent_of_code_2025_day11_part2(const std::filesystem::path &file_path)
 {
-    const auto graph = read_input(file_path);
-    std::map<std::tuple<std::string, bool, bool>, long long> memo;
-    const bool startVisitedDac = (std::string("svr") == "dac");
-    const bool startVisitedFft = (std::string("svr") == "fft");
-    const long long totalValidPaths = count_paths_with_nodes("svr", "out", startVisitedDac, startVisitedFft, graph, memo);
-    return totalValidPaths;
+    return advent_of_code_2025_day11_part2(read_input(file_path));
+}
+
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 11 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day11_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day11_part2(input); });
 }
 
+} // namespace aoc2025::day11
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -184,6 +350,8 @@
  */
 int main()
 {
+    using namespace aoc2025::day11;
+
     try
     {
         const std::filesystem::path example_file_part1 = "input_example_part1.txt";
@@ -202,11 +370,10 @@ int main()
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day11_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Number of paths: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day11_part2(input_file);
         std::cout << "Number of valid paths: " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -216,4 +383,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
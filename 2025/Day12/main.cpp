@@ -1,14 +1,26 @@
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <set>
-#include <map>
 #include <algorithm>
+#include <array>
+#include <map>
+#include <optional>
+#include <fstream>
+#include <utility>
+#include <bit>
+#include <cstdint>
 #include <filesystem>
 #include <stdexcept>
 
+#include "../../common/input.hpp"
+#include "../../common/parse_cache.hpp"
+#include "../../common/stats.hpp"
+#include "../../common/thread_pool.hpp"
+
+namespace aoc2025::day12
+{
+
 /**
  * @struct Shape
  * @brief Represents a present shape pattern.
@@ -53,25 +65,9 @@ struct InputData
  * @return InputData structure with shapes and regions
  * @throws std::runtime_error if the file doesn't exist or cannot be opened
  */
-[[nodiscard]] InputData read_input(const std::filesystem::path &file_path)
+[[nodiscard]] InputData parse_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
-
-    std::vector<std::string> lines;
-    std::string line;
-    while (std::getline(file, line))
-    {
-        lines.push_back(line);
-    }
+    const aoc::InputLines lines(file_path);
 
     InputData data;
     size_t i = 0;
@@ -79,7 +75,7 @@ struct InputData
     // Parse shapes
     while (i < lines.size())
     {
-        line = lines[i];
+        const std::string_view line = lines[i];
 
         if (line.empty())
         {
@@ -88,20 +84,20 @@ struct InputData
         }
 
         // Check if it's a region definition
-        if (line.find('x') != std::string::npos && line.find(':') != std::string::npos)
+        if (line.find('x') != std::string_view::npos && line.find(':') != std::string_view::npos)
         {
             break;
         }
 
         // Check if it's a shape definition
-        if (line.find(':') != std::string::npos && line.find('x') == std::string::npos)
+        if (line.find(':') != std::string_view::npos && line.find('x') == std::string_view::npos)
         {
             i++; // Skip the "N:" line
             Shape shape;
 
             while (i < lines.size() && !lines[i].empty())
             {
-                shape.pattern.push_back(lines[i]);
+                shape.pattern.emplace_back(lines[i]);
                 i++;
             }
 
@@ -125,24 +121,23 @@ struct InputData
             continue;
         }
 
-        if (lines[i].find('x') == std::string::npos)
+        if (lines[i].find('x') == std::string_view::npos)
         {
             i++;
             continue;
         }
 
         size_t colonPos = lines[i].find(':');
-        std::string dimensions = lines[i].substr(0, colonPos);
-        std::string countsStr = lines[i].substr(colonPos + 1);
+        const std::string_view dimensions = lines[i].substr(0, colonPos);
+        std::string_view countsStr = lines[i].substr(colonPos + 1);
 
         size_t xPos = dimensions.find('x');
-        int width = std::stoi(dimensions.substr(0, xPos));
-        int height = std::stoi(dimensions.substr(xPos + 1));
+        int width = aoc::parse_int<int>(dimensions.substr(0, xPos));
+        int height = aoc::parse_int<int>(dimensions.substr(xPos + 1));
 
         std::vector<int> presentCounts;
-        std::istringstream iss(countsStr);
         int count;
-        while (iss >> count)
+        while (aoc::consume_int(countsStr, count))
         {
             presentCounts.push_back(count);
         }
@@ -154,314 +149,927 @@ struct InputData
     return data;
 }
 
+/// Layout of InputData in the parse cache; bump when save() changes
+inline constexpr std::uint32_t kCacheSchema = 20251201;
+
+/**
+ * @brief Serialize shapes and regions for the parse cache.
+ * @param writer Destination
+ * @param data Parsed input
+ */
+void save(aoc::BinaryWriter &writer, const InputData &data)
+{
+    writer.write<std::uint64_t>(data.shapes.size());
+    for (const auto &shape : data.shapes)
+    {
+        writer.write<std::uint64_t>(shape.pattern.size());
+        for (const auto &row : shape.pattern)
+        {
+            writer.write_string(row);
+        }
+    }
+
+    writer.write<std::uint64_t>(data.regions.size());
+    for (const auto &[size, counts] : data.regions)
+    {
+        writer.write(size.first);
+        writer.write(size.second);
+        writer.write_vector(counts);
+    }
+}
+
+/**
+ * @brief Deserialize shapes and regions written by save().
+ *
+ * @param reader Source
+ * @param data Receives the parsed input
+ * @throws std::runtime_error if the data is truncated
+ */
+void load(aoc::BinaryReader &reader, InputData &data)
+{
+    data.shapes.resize(reader.read<std::uint64_t>());
+    for (auto &shape : data.shapes)
+    {
+        shape.pattern.resize(reader.read<std::uint64_t>());
+        for (auto &row : shape.pattern)
+        {
+            row = reader.read_string();
+        }
+    }
+
+    data.regions.resize(reader.read<std::uint64_t>());
+    for (auto &[size, counts] : data.regions)
+    {
+        size.first = reader.read<int>();
+        size.second = reader.read<int>();
+        counts = reader.read_vector<int>();
+    }
+}
+
+/**
+ * @brief Read and parse input from file, through the parse cache when it is enabled.
+ *
+ * @param file_path Path to the input file
+ * @return InputData structure with shapes and regions
+ * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ */
+[[nodiscard]] InputData read_input(const std::filesystem::path &file_path)
+{
+    return aoc::parse_cache::load_or_parse<InputData>(file_path, kCacheSchema, parse_input);
+}
+
+/// Widest board row that fits in one bitboard word
+constexpr int kMaxBoardWidth = 64;
+
+/**
+ * @struct ShapeMask
+ * @brief One transformation of a present packed into per-row bitmasks.
+ */
+struct ShapeMask
+{
+    std::vector<std::uint64_t> rows; ///< Bit j of rows[i] is set if cell (i, j) is filled
+    int width = 0;                   ///< Width of the bounding box
+    int anchor = 0;                  ///< Column of the first filled cell in row 0
+    int cells = 0;                   ///< Number of filled cells
+};
+
+/**
+ * @brief Trim a mask to its bounding box and refresh its derived fields.
+ *
+ * Empty border rows and columns are removed so the anchor is always on the
+ * first row and the bounding box does not keep the shape away from the
+ * board edges. Two transformations are the same shape exactly when their
+ * trimmed rows are equal.
+ *
+ * @param mask Mask to normalize in place
+ */
+void normalize(ShapeMask &mask)
+{
+    while (!mask.rows.empty() && mask.rows.back() == 0)
+    {
+        mask.rows.pop_back();
+    }
+    const auto firstFilled = std::find_if(mask.rows.begin(), mask.rows.end(), [](std::uint64_t bits)
+                                          { return bits != 0; });
+    mask.rows.erase(mask.rows.begin(), firstFilled);
+
+    std::uint64_t columns = 0;
+    mask.cells = 0;
+    for (const std::uint64_t bits : mask.rows)
+    {
+        columns |= bits;
+        mask.cells += std::popcount(bits);
+    }
+    if (columns != 0)
+    {
+        const int shift = std::countr_zero(columns);
+        for (std::uint64_t &bits : mask.rows)
+        {
+            bits >>= shift;
+        }
+        columns >>= shift;
+    }
+    mask.width = std::bit_width(columns);
+    mask.anchor = mask.rows.empty() ? 0 : std::countr_zero(mask.rows.front());
+}
+
 /**
- * @brief Generate all rotations and flips of a shape.
+ * @brief Pack a shape pattern into row masks.
+ *
+ * @param shape Shape to convert
+ * @return Packed, normalized shape
+ * @throws std::runtime_error if a rotation of the shape would be wider than a bitboard row
+ */
+[[nodiscard]] ShapeMask to_mask(const Shape &shape)
+{
+    if (shape.width() > kMaxBoardWidth || shape.height() > kMaxBoardWidth)
+    {
+        throw std::runtime_error("Shape too wide: " + std::to_string(std::max(shape.width(), shape.height())));
+    }
+
+    ShapeMask mask;
+    for (const auto &line : shape.pattern)
+    {
+        std::uint64_t bits = 0;
+        for (int j = 0; j < static_cast<int>(line.size()); j++)
+        {
+            if (line[j] == '#')
+            {
+                bits |= std::uint64_t{1} << j;
+            }
+        }
+        mask.rows.push_back(bits);
+    }
+
+    normalize(mask);
+    return mask;
+}
+
+/**
+ * @brief Rotate a packed shape by 90 degrees clockwise.
+ *
+ * @param mask Normalized shape
+ * @return Rotated, normalized shape; cell (i, j) moves to (j, height - 1 - i)
+ */
+[[nodiscard]] ShapeMask rotate(const ShapeMask &mask)
+{
+    const int h = static_cast<int>(mask.rows.size());
+    ShapeMask rotated;
+    rotated.rows.assign(mask.width, 0);
+    for (int i = 0; i < h; i++)
+    {
+        for (std::uint64_t bits = mask.rows[i]; bits != 0; bits &= bits - 1)
+        {
+            rotated.rows[std::countr_zero(bits)] |= std::uint64_t{1} << (h - 1 - i);
+        }
+    }
+    normalize(rotated);
+    return rotated;
+}
+
+/**
+ * @brief Mirror a packed shape horizontally.
+ *
+ * @param mask Normalized shape
+ * @return Mirrored, normalized shape; cell (i, j) moves to (i, width - 1 - j)
+ */
+[[nodiscard]] ShapeMask flip(const ShapeMask &mask)
+{
+    ShapeMask flipped;
+    flipped.rows.reserve(mask.rows.size());
+    for (const std::uint64_t bits : mask.rows)
+    {
+        std::uint64_t mirrored = 0;
+        for (std::uint64_t rest = bits; rest != 0; rest &= rest - 1)
+        {
+            mirrored |= std::uint64_t{1} << (mask.width - 1 - std::countr_zero(rest));
+        }
+        flipped.rows.push_back(mirrored);
+    }
+    normalize(flipped);
+    return flipped;
+}
+
+/**
+ * @brief Generate all distinct rotations and flips of a shape.
+ *
+ * Works on the packed rows directly; duplicates from symmetric shapes are
+ * dropped by comparing the normalized rows of the at most eight results.
  *
  * @param shape Input shape
- * @return Vector of all unique transformations
+ * @return Distinct transformations, the original first
+ * @throws std::runtime_error if a rotation of the shape would be wider than a bitboard row
  */
-[[nodiscard]] std::vector<Shape> generate_transformations(const Shape &shape)
+[[nodiscard]] std::vector<ShapeMask> generate_transformations(const Shape &shape)
 {
-    std::vector<Shape> result;
-    std::set<std::vector<std::string>> unique;
+    std::vector<ShapeMask> result;
 
-    const auto addIfUnique = [&](const Shape &s)
+    const auto addIfUnique = [&](ShapeMask mask)
     {
-        if (unique.find(s.pattern) == unique.end())
+        const bool seen = std::any_of(result.begin(), result.end(), [&](const ShapeMask &other)
+                                      { return other.rows == mask.rows; });
+        if (!seen)
         {
-            unique.insert(s.pattern);
-            result.push_back(s);
+            result.push_back(std::move(mask));
         }
     };
 
-    // Original
-    Shape current = shape;
-    addIfUnique(current);
-
-    // 3 rotations
-    for (int r = 0; r < 3; ++r)
+    const ShapeMask original = to_mask(shape);
+    for (ShapeMask current : {original, flip(original)})
     {
-        Shape rotated;
-        const int h = current.height();
-        const int w = current.width();
-        rotated.pattern.resize(w);
-        for (int i = 0; i < w; i++)
+        for (int r = 0; r < 4; ++r)
         {
-            rotated.pattern[i] = std::string(h, '.');
+            ShapeMask next = rotate(current);
+            addIfUnique(std::move(current));
+            current = std::move(next);
         }
+    }
+
+    return result;
+}
+
+/**
+ * @class Bitboard
+ * @brief Region grid with one 64-bit word per row and a live free-cell count.
+ */
+class Bitboard
+{
+public:
+    /**
+     * @brief Create an empty board.
+     *
+     * @param width Number of columns, at most kMaxBoardWidth
+     * @param height Number of rows
+     */
+    Bitboard(int width, int height)
+        : rows_(height, 0), width_(width), free_(width * height),
+          full_(width == kMaxBoardWidth ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1)
+    {
+    }
 
-        for (int i = 0; i < h; i++)
+    /**
+     * @brief Check whether a shape fits with its top-left corner at a cell.
+     *
+     * @param shape Packed shape
+     * @param row Top row of the shape's bounding box
+     * @param col Left column of the shape's bounding box
+     * @return True if the shape stays on the board and overlaps nothing
+     */
+    [[nodiscard]] bool fits(const ShapeMask &shape, int row, int col) const noexcept
+    {
+        if (col < 0 || col + shape.width > width_ || row + static_cast<int>(shape.rows.size()) > height())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < shape.rows.size(); i++)
         {
-            for (int j = 0; j < w; j++)
+            if (rows_[row + i] & (shape.rows[i] << col))
             {
-                rotated.pattern[j][h - 1 - i] = current.pattern[i][j];
+                return false;
             }
         }
-        current = rotated;
-        addIfUnique(current);
+        return true;
     }
 
-    // Flip horizontally and repeat rotations
-    Shape flipped = shape;
-    for (auto &row : flipped.pattern)
+    /**
+     * @brief Place a shape where fits() allowed it.
+     *
+     * @param shape Packed shape
+     * @param row Top row of the shape's bounding box
+     * @param col Left column of the shape's bounding box
+     */
+    void place(const ShapeMask &shape, int row, int col) noexcept
     {
-        std::reverse(row.begin(), row.end());
+        for (size_t i = 0; i < shape.rows.size(); i++)
+        {
+            rows_[row + i] |= shape.rows[i] << col;
+        }
+        free_ -= shape.cells;
     }
-    addIfUnique(flipped);
 
-    current = flipped;
-    for (int r = 0; r < 3; ++r)
+    /**
+     * @brief Remove a shape placed by place().
+     *
+     * @param shape Packed shape
+     * @param row Top row of the shape's bounding box
+     * @param col Left column of the shape's bounding box
+     */
+    void remove(const ShapeMask &shape, int row, int col) noexcept
     {
-        Shape rotated;
-        const int h = current.height();
-        const int w = current.width();
-        rotated.pattern.resize(w);
-        for (int i = 0; i < w; i++)
+        for (size_t i = 0; i < shape.rows.size(); i++)
         {
-            rotated.pattern[i] = std::string(h, '.');
+            rows_[row + i] ^= shape.rows[i] << col;
         }
+        free_ += shape.cells;
+    }
+
+    /**
+     * @brief Flip a single cell between empty and filled.
+     *
+     * @param row Cell row
+     * @param col Cell column
+     */
+    void toggle(int row, int col) noexcept
+    {
+        const std::uint64_t bit = std::uint64_t{1} << col;
+        rows_[row] ^= bit;
+        free_ += (rows_[row] & bit) ? -1 : 1;
+    }
 
-        for (int i = 0; i < h; i++)
+    /**
+     * @brief Find the first empty cell in row-major order.
+     *
+     * @param fromRow Row to start scanning at; all earlier rows must be full
+     * @param row Receives the row of the empty cell
+     * @param col Receives the column of the empty cell
+     * @return False if the board is full from fromRow on
+     */
+    [[nodiscard]] bool first_empty(int fromRow, int &row, int &col) const noexcept
+    {
+        for (int r = fromRow; r < height(); r++)
         {
-            for (int j = 0; j < w; j++)
+            const std::uint64_t empty = ~rows_[r] & full_;
+            if (empty != 0)
             {
-                rotated.pattern[j][h - 1 - i] = current.pattern[i][j];
+                row = r;
+                col = std::countr_zero(empty);
+                return true;
             }
         }
-        current = rotated;
-        addIfUnique(current);
+        return false;
     }
 
-    return result;
-}
+    /**
+     * @brief Get the number of empty cells.
+     * @return Cells not covered by a present or given up
+     */
+    [[nodiscard]] int free_cells() const noexcept { return free_; }
+
+    /**
+     * @brief Get the number of columns.
+     * @return Board width
+     */
+    [[nodiscard]] int width() const noexcept { return width_; }
+
+    /**
+     * @brief Get the number of rows.
+     * @return Board height
+     */
+    [[nodiscard]] int height() const noexcept { return static_cast<int>(rows_.size()); }
+
+private:
+    std::vector<std::uint64_t> rows_; ///< Filled cells, bit j of rows_[i] = cell (i, j)
+    int width_;                       ///< Number of columns
+    int free_;                        ///< Number of empty cells
+    std::uint64_t full_;              ///< Mask of all columns in a row
+};
 
 /**
- * @brief Check if shape can be placed at position.
+ * @brief Backtracking algorithm to place all presents.
  *
- * @param grid Current grid state
- * @param shape Shape to place
- * @param row Starting row position
- * @param col Starting column position
- * @return True if placement is valid
+ * The first empty cell in row-major order is always decided next: either a
+ * present is placed with its first filled cell on it, or the cell is given
+ * up and stays empty for good. Every packing is therefore reached in exactly
+ * one way, without the permutations of placement order that a search over
+ * all positions produces.
+ *
+ * @param board Board to fill
+ * @param allMasks Packed transformations of every shape
+ * @param remaining Presents of each shape still to place
+ * @param needed Cells the remaining presents cover
+ * @param fromRow First row that may still contain empty cells
+ * @param stats Search counters; the depth is measured in decided cells
+ * @return True if all presents can be placed
  */
-[[nodiscard]] bool can_place(const std::vector<std::string> &grid, const Shape &shape, int row, int col)
+[[nodiscard]] bool try_place_presents(Bitboard &board, const std::vector<std::vector<ShapeMask>> &allMasks,
+                                      std::vector<int> &remaining, int needed, int fromRow, aoc::stats::Counters &stats)
 {
-    if (row + shape.height() > static_cast<int>(grid.size()) || col + shape.width() > static_cast<int>(grid[0].size()))
+    stats.add(aoc::stats::Counter::NodesExpanded);
+    stats.depth(board.width() * board.height() - board.free_cells());
+
+    // All presents placed successfully
+    if (needed == 0)
+    {
+        return true;
+    }
+
+    // Early termination: check if enough space remains
+    if (needed > board.free_cells())
+    {
+        stats.add(aoc::stats::Counter::PrunedByArea);
+        return false;
+    }
+
+    int row = 0;
+    int col = 0;
+    if (!board.first_empty(fromRow, row, col))
     {
         return false;
     }
 
-    for (int i = 0; i < shape.height(); i++)
+    // Cover the cell with any present that still has copies left
+    for (size_t p = 0; p < remaining.size(); p++)
     {
-        for (int j = 0; j < shape.width(); j++)
+        if (remaining[p] == 0)
+            continue;
+
+        for (const auto &shape : allMasks[p])
         {
-            if (shape.pattern[i][j] == '#')
+            const int left = col - shape.anchor;
+            if (!board.fits(shape, row, left))
+                continue;
+
+            board.place(shape, row, left);
+            remaining[p]--;
+            const bool placed = try_place_presents(board, allMasks, remaining, needed - shape.cells, row, stats);
+            remaining[p]++;
+            board.remove(shape, row, left);
+
+            if (placed)
             {
-                if (grid[row + i][col + j] != '.')
-                {
-                    return false;
-                }
+                return true;
             }
         }
     }
-    return true;
+
+    // Or leave the cell empty
+    board.toggle(row, col);
+    const bool placed = try_place_presents(board, allMasks, remaining, needed, row, stats);
+    board.toggle(row, col);
+    return placed;
 }
 
 /**
- * @brief Place a shape on the grid.
+ * @brief Count the cells covered by all presents of a region.
  *
- * @param grid Grid to modify
- * @param shape Shape to place
- * @param row Starting row position
- * @param col Starting column position
- * @param marker Character marker for this shape
+ * @param presentCounts Count of each present type
+ * @param allMasks Packed transformations of every shape
+ * @return Total filled cells of the presents
+ * @throws std::runtime_error if the region refers to unknown shapes
  */
-void place_shape(std::vector<std::string> &grid, const Shape &shape, int row, int col, char marker)
+[[nodiscard]] int count_needed_cells(const std::vector<int> &presentCounts,
+                                     const std::vector<std::vector<ShapeMask>> &allMasks)
 {
-    for (int i = 0; i < shape.height(); i++)
+    int needed = 0;
+    for (size_t p = 0; p < presentCounts.size(); p++)
     {
-        for (int j = 0; j < shape.width(); j++)
+        if (presentCounts[p] == 0)
+            continue;
+        if (p >= allMasks.size())
         {
-            if (shape.pattern[i][j] == '#')
-            {
-                grid[row + i][col + j] = marker;
-            }
+            throw std::runtime_error("Region refers to unknown shape " + std::to_string(p));
         }
+        needed += presentCounts[p] * allMasks[p].front().cells;
     }
+    return needed;
 }
 
 /**
- * @brief Remove a shape from the grid.
+ * @brief Check whether all presents of a region fit into it.
  *
- * @param grid Grid to modify
- * @param shape Shape to remove
- * @param row Starting row position
- * @param col Starting column position
+ * @param width Region width
+ * @param height Region height
+ * @param presentCounts Count of each present type
+ * @param allMasks Packed transformations of every shape
+ * @param stats Receives the search counters
+ * @return True if the presents can be packed
+ * @throws std::runtime_error if the region refers to unknown shapes or is too large
  */
-void remove_shape(std::vector<std::string> &grid, const Shape &shape, int row, int col)
+[[nodiscard]] bool region_fits(int width, int height, const std::vector<int> &presentCounts,
+                               const std::vector<std::vector<ShapeMask>> &allMasks, aoc::stats::Counters &stats)
 {
-    for (int i = 0; i < shape.height(); i++)
+    // Shapes come with all rotations, so a region can be turned to fit the board word
+    if (width > kMaxBoardWidth)
     {
-        for (int j = 0; j < shape.width(); j++)
-        {
-            if (shape.pattern[i][j] == '#')
-            {
-                grid[row + i][col + j] = '.';
-            }
-        }
+        std::swap(width, height);
     }
+    if (width > kMaxBoardWidth)
+    {
+        throw std::runtime_error("Region too large: " + std::to_string(width) + "x" + std::to_string(height));
+    }
+
+    std::vector<int> remaining = presentCounts;
+    Bitboard board(width, height);
+    return try_place_presents(board, allMasks, remaining, count_needed_cells(presentCounts, allMasks), 0, stats);
 }
 
 /**
- * @brief Count empty cells in grid.
+ * @enum RegionTier
+ * @brief Stage of the pipeline that decided a region.
+ */
+enum class RegionTier : unsigned char
+{
+    FitsByTiling,  ///< Every present gets its own bounding-box square
+    AreaExceeded,  ///< The presents cover more cells than the region has
+    FitsBySearch,  ///< The packing search found an arrangement
+    FailsBySearch, ///< The packing search proved there is none
+};
+
+/// Number of RegionTier values
+constexpr std::size_t kTierCount = 4;
+
+/**
+ * @struct RegionReport
+ * @brief Outcome of every region and how many regions each tier resolved.
+ */
+struct RegionReport
+{
+    std::vector<RegionTier> tiers;            ///< Deciding tier per region, in input order
+    std::array<int, kTierCount> resolved{};   ///< Regions decided by each tier
+
+    /**
+     * @brief Count the regions that can hold their presents.
+     * @return Regions accepted by tiling or by search
+     */
+    [[nodiscard]] int valid() const noexcept
+    {
+        return resolved[static_cast<std::size_t>(RegionTier::FitsByTiling)] +
+               resolved[static_cast<std::size_t>(RegionTier::FitsBySearch)];
+    }
+};
+
+/**
+ * @brief Pack every shape's transformations into bitmasks.
  *
- * @param grid Grid to analyze
- * @return Number of empty cells
+ * @param shapes Parsed shapes
+ * @return Packed transformations per shape
  */
-[[nodiscard]] int count_empty(const std::vector<std::string> &grid) noexcept
+[[nodiscard]] std::vector<std::vector<ShapeMask>> build_masks(const std::vector<Shape> &shapes)
 {
-    int count = 0;
-    for (const auto &row : grid)
+    std::vector<std::vector<ShapeMask>> allMasks;
+    allMasks.reserve(shapes.size());
+    for (const auto &shape : shapes)
     {
-        for (const char c : row)
-        {
-            if (c == '.')
-                count++;
-        }
+        allMasks.push_back(generate_transformations(shape));
     }
-    return count;
+    return allMasks;
 }
 
 /**
- * @brief Count total cells needed for remaining presents.
+ * @struct RegionKey
+ * @brief Canonical form of a region query, shared by all equivalent regions.
  *
- * @param allTransformations All shape transformations
- * @param presentCounts Count of each present type
- * @param presentIdx Current present index
- * @param countIdx Current count index
- * @return Total cells needed
+ * Presents come with every rotation, so a w x h region is equivalent to an
+ * h x w one; keys always store the shorter side first. Trailing zero counts
+ * are dropped, and the fingerprint of the shape set is part of the key so
+ * answers saved from other inputs are never reused.
  */
-[[nodiscard]] int count_needed_cells(const std::vector<std::vector<Shape>> &allTransformations,
-                                     const std::vector<int> &presentCounts, const int presentIdx, const int countIdx) noexcept
+struct RegionKey
 {
-    int needed = 0;
-    for (size_t p = presentIdx; p < presentCounts.size(); ++p)
+    std::uint64_t shapes = 0; ///< Fingerprint of the shapes the answer depends on
+    int width = 0;            ///< Shorter side of the region
+    int height = 0;           ///< Longer side of the region
+    std::vector<int> counts;  ///< Presents of each shape, without trailing zeros
+
+    auto operator<=>(const RegionKey &) const = default;
+};
+
+/**
+ * @brief Hash the packed shapes a set of answers depends on.
+ *
+ * FNV-1a over the rows of every shape's first transformation.
+ *
+ * @param allMasks Packed transformations of every shape
+ * @return Fingerprint that changes whenever a shape does
+ */
+[[nodiscard]] std::uint64_t shapes_fingerprint(const std::vector<std::vector<ShapeMask>> &allMasks) noexcept
+{
+    constexpr std::uint64_t kOffsetBasis = 14695981039346656037ULL;
+    constexpr std::uint64_t kPrime = 1099511628211ULL;
+
+    std::uint64_t hash = kOffsetBasis;
+    const auto mix = [&](std::uint64_t value)
     {
-        const int startCount = (static_cast<int>(p) == presentIdx) ? countIdx : 0;
-        int shapeSize = 0;
-        for (const auto &row : allTransformations[p][0].pattern)
+        for (int byte = 0; byte < 8; byte++)
         {
-            for (const char c : row)
-            {
-                if (c == '#')
-                    shapeSize++;
-            }
+            hash = (hash ^ ((value >> (8 * byte)) & 0xFF)) * kPrime;
+        }
+    };
+
+    for (const auto &masks : allMasks)
+    {
+        mix(masks.front().rows.size());
+        for (const std::uint64_t bits : masks.front().rows)
+        {
+            mix(bits);
         }
-        needed += (presentCounts[p] - startCount) * shapeSize;
     }
-    return needed;
+    return hash;
 }
 
 /**
- * @brief Backtracking algorithm to place all presents.
+ * @brief Build the canonical key of a region.
  *
- * @param grid Grid to fill
- * @param allTransformations All shape transformations
+ * @param shapes Fingerprint of the shape set
+ * @param width Region width
+ * @param height Region height
  * @param presentCounts Count of each present type
- * @param presentIdx Current present index
- * @param countIdx Current count index
- * @return True if all presents can be placed
+ * @return Key with width <= height and trailing zero counts removed
  */
-[[nodiscard]] bool try_place_presents(std::vector<std::string> &grid, const std::vector<std::vector<Shape>> &allTransformations,
-                                      const std::vector<int> &presentCounts, int presentIdx, int countIdx)
+[[nodiscard]] RegionKey canonical_region(std::uint64_t shapes, int width, int height, const std::vector<int> &presentCounts)
 {
-    // All presents placed successfully
-    if (presentIdx >= presentCounts.size())
+    RegionKey key{shapes, std::min(width, height), std::max(width, height), presentCounts};
+    while (!key.counts.empty() && key.counts.back() == 0)
     {
-        return true;
+        key.counts.pop_back();
     }
+    return key;
+}
 
-    // Skip shapes with 0 count
-    if (countIdx >= presentCounts[presentIdx])
+/**
+ * @class RegionCache
+ * @brief Search outcomes by canonical region, optionally kept in a text file.
+ *
+ * Each line of the file is "shapes width height fits count...", all
+ * integers; lines starting with '#' are comments.
+ */
+class RegionCache
+{
+public:
+    /**
+     * @brief Look up a region.
+     *
+     * @param key Canonical region
+     * @return Whether the presents fit, or std::nullopt if the region was never searched
+     */
+    [[nodiscard]] std::optional<bool> find(const RegionKey &key) const
     {
-        return try_place_presents(grid, allTransformations, presentCounts, presentIdx + 1, 0);
+        const auto it = entries_.find(key);
+        return it == entries_.end() ? std::nullopt : std::optional<bool>(it->second);
     }
 
-    // Early termination: check if enough space remains
-    const int needed = count_needed_cells(allTransformations, presentCounts, presentIdx, countIdx);
-    const int available = count_empty(grid);
-    if (needed > available)
+    /**
+     * @brief Record the outcome of a search.
+     *
+     * @param key Canonical region
+     * @param fits Whether the presents fit
+     */
+    void insert(RegionKey key, bool fits) { entries_.insert_or_assign(std::move(key), fits); }
+
+    /**
+     * @brief Get the number of cached regions.
+     * @return Entry count
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+
+    /**
+     * @brief Read a cache file.
+     *
+     * @param file_path Path to the cache file
+     * @return Cached outcomes; empty if the file does not exist
+     * @throws std::runtime_error if the file exists but holds a malformed entry
+     */
+    [[nodiscard]] static RegionCache load(const std::filesystem::path &file_path)
     {
-        return false;
+        RegionCache cache;
+        if (!std::filesystem::exists(file_path))
+        {
+            return cache;
+        }
+
+        const aoc::InputLines lines(file_path, true);
+        for (size_t i = 0; i < lines.size(); i++)
+        {
+            std::string_view line = lines[i];
+            if (aoc::trim(line).empty() || aoc::trim(line).front() == '#')
+            {
+                continue;
+            }
+
+            RegionKey key;
+            int fits = 0;
+            if (!aoc::consume_int(line, key.shapes) || !aoc::consume_int(line, key.width) ||
+                !aoc::consume_int(line, key.height) || !aoc::consume_int(line, fits))
+            {
+                throw std::runtime_error("Invalid region cache entry at line " + std::to_string(i + 1));
+            }
+            int count = 0;
+            while (aoc::consume_int(line, count))
+            {
+                key.counts.push_back(count);
+            }
+            cache.insert(std::move(key), fits != 0);
+        }
+        return cache;
     }
 
-    // Try each transformation of the current shape
-    for (const auto &shape : allTransformations[presentIdx])
+    /**
+     * @brief Write every cached outcome to a file, replacing it.
+     *
+     * @param file_path Path to the cache file
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save(const std::filesystem::path &file_path) const
     {
-        // Try each position in the grid
-        for (size_t row = 0; row < grid.size(); ++row)
+        std::ofstream file(file_path);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Cannot write file: " + file_path.string());
+        }
+
+        file << "# shapes width height fits counts...\n";
+        for (const auto &[key, fits] : entries_)
         {
-            for (size_t col = 0; col < grid[0].size(); ++col)
+            file << key.shapes << ' ' << key.width << ' ' << key.height << ' ' << (fits ? 1 : 0);
+            for (const int count : key.counts)
             {
-                if (can_place(grid, shape, static_cast<int>(row), static_cast<int>(col)))
-                {
-                    place_shape(grid, shape, static_cast<int>(row), static_cast<int>(col), static_cast<char>('A' + presentIdx));
-
-                    if (try_place_presents(grid, allTransformations, presentCounts,
-                                           presentIdx, countIdx + 1))
-                    {
-                        return true;
-                    }
-
-                    remove_shape(grid, shape, static_cast<int>(row), static_cast<int>(col));
-                }
+                file << ' ' << count;
             }
+            file << '\n';
         }
     }
 
-    return false;
+private:
+    std::map<RegionKey, bool> entries_; ///< Outcome per canonical region
+};
+
+/**
+ * @brief Decide a region with the constant-time checks if possible.
+ *
+ * A region with room for one tile x tile square per present always fits,
+ * since each present's bounding box fits in such a square. A region with
+ * fewer cells than the presents cover never fits. The shape indices are
+ * validated before either check.
+ *
+ * @param width Region width
+ * @param height Region height
+ * @param presentCounts Count of each present type
+ * @param allMasks Packed transformations of every shape
+ * @param tile Side of a square that holds any shape's bounding box
+ * @return Deciding tier, or FitsBySearch as a placeholder if the search must decide
+ * @throws std::runtime_error if the region refers to unknown shapes
+ */
+[[nodiscard]] RegionTier prefilter_region(int width, int height, const std::vector<int> &presentCounts,
+                                          const std::vector<std::vector<ShapeMask>> &allMasks, int tile)
+{
+    const long long needed = count_needed_cells(presentCounts, allMasks);
+
+    long long total = 0;
+    for (const int count : presentCounts)
+    {
+        total += count;
+    }
+
+    if (static_cast<long long>(width / tile) * (height / tile) >= total)
+    {
+        return RegionTier::FitsByTiling;
+    }
+    if (needed > static_cast<long long>(width) * height)
+    {
+        return RegionTier::AreaExceeded;
+    }
+    return RegionTier::FitsBySearch;
 }
 
 /**
- * @brief Solve Advent of Code 2025 Day 12 Part 1.
+ * @brief Decide every region, searching only the ones the checks leave open.
  *
- * Counts how many regions can be completely filled with presents.
+ * Ambiguous regions are reduced to their canonical keys. Keys already in
+ * the cache reuse the stored outcome, repeated keys are searched once, and
+ * the remaining searches are independent, so they run concurrently on a
+ * thread pool. New outcomes are added to the cache.
  *
- * @param file_path Path to the input file
- * @return Number of valid regions
- * @throws std::runtime_error if the file cannot be read
+ * @param data Parsed shapes and regions
+ * @param cache Outcomes of earlier searches, extended in place
+ * @return Tier and outcome of every region; cached outcomes count as search tiers
+ * @throws std::runtime_error if a region refers to unknown shapes or is too large
  */
-[[nodiscard]] int advent_of_code_2025_day12_part1(const std::filesystem::path &file_path)
+[[nodiscard]] RegionReport evaluate_regions(const InputData &data, RegionCache &cache)
 {
-    const auto data = read_input(file_path);
+    const auto allMasks = build_masks(data.shapes);
+    const std::uint64_t shapes = shapes_fingerprint(allMasks);
 
-    // Generate all transformations for each shape
-    std::vector<std::vector<Shape>> allTransformations;
-    allTransformations.reserve(data.shapes.size());
-    for (const auto &shape : data.shapes)
+    int tile = 1;
+    for (const auto &masks : allMasks)
     {
-        allTransformations.push_back(generate_transformations(shape));
+        for (const auto &mask : masks)
+        {
+            tile = std::max({tile, mask.width, static_cast<int>(mask.rows.size())});
+        }
     }
 
-    // Check each region
-    int validRegions = 0;
-    for (const auto &region : data.regions)
+    RegionReport report;
+    report.tiers.resize(data.regions.size());
+
+    std::map<RegionKey, std::vector<size_t>> pending; // unsearched key -> regions sharing it
+    for (size_t i = 0; i < data.regions.size(); i++)
     {
-        const int width = region.first.first;
-        const int height = region.first.second;
-        const auto &presentCounts = region.second;
+        const auto &[size, presentCounts] = data.regions[i];
+        report.tiers[i] = prefilter_region(size.first, size.second, presentCounts, allMasks, tile);
+        if (report.tiers[i] != RegionTier::FitsBySearch)
+        {
+            continue;
+        }
 
-        std::vector<std::string> grid(height, std::string(width, '.'));
+        RegionKey key = canonical_region(shapes, size.first, size.second, presentCounts);
+        if (const auto cached = cache.find(key))
+        {
+            report.tiers[i] = *cached ? RegionTier::FitsBySearch : RegionTier::FailsBySearch;
+        }
+        else
+        {
+            pending[std::move(key)].push_back(i);
+        }
+    }
 
-        if (try_place_presents(grid, allTransformations, presentCounts, 0, 0))
+    if (!pending.empty())
+    {
+        std::vector<const RegionKey *> keys;
+        keys.reserve(pending.size());
+        for (const auto &entry : pending)
         {
-            validRegions++;
+            keys.push_back(&entry.first);
+        }
+        std::vector<char> fits(keys.size(), 0);
+        std::vector<aoc::stats::Counters> stats(keys.size());
+
+        aoc::ThreadPool pool(static_cast<unsigned>(std::min<size_t>(keys.size(), aoc::ThreadBudget::threads())));
+        for (size_t k = 0; k < keys.size(); k++)
+        {
+            pool.submit([&, k]
+                        {
+                            const RegionKey &key = *keys[k];
+                            const aoc::stats::Stopwatch timer(stats[k]);
+                            fits[k] = region_fits(key.width, key.height, key.counts, allMasks, stats[k]); });
+        }
+        pool.wait();
+
+        for (size_t k = 0; k < keys.size(); k++)
+        {
+            const auto &regions = pending[*keys[k]];
+            aoc::stats::record("region", regions.front() + 1, stats[k]);
+            for (const size_t i : regions)
+            {
+                report.tiers[i] = fits[k] ? RegionTier::FitsBySearch : RegionTier::FailsBySearch;
+            }
+            cache.insert(*keys[k], fits[k] != 0);
         }
     }
 
-    return validRegions;
+    for (const RegionTier tier : report.tiers)
+    {
+        report.resolved[static_cast<std::size_t>(tier)]++;
+    }
+    return report;
+}
+
+/**
+ * @brief Decide every region with a cache local to this call.
+ *
+ * @param data Parsed shapes and regions
+ * @return Tier and outcome of every region
+ * @throws std::runtime_error if a region refers to unknown shapes or is too large
+ */
+[[nodiscard]] RegionReport evaluate_regions(const InputData &data)
+{
+    RegionCache cache;
+    return evaluate_regions(data, cache);
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 12 Part 1.
+ *
+ * Counts how many regions can hold all of their presents.
+ *
+ * @param data Parsed shapes and regions
+ * @return Number of valid regions
+ */
+[[nodiscard]] int advent_of_code_2025_day12_part1(const InputData &data)
+{
+    return evaluate_regions(data).valid();
 }
 
+/**
+ * @brief Solve Advent of Code 2025 Day 12 Part 1 from an input file.
+ *
+ * @param file_path Path to the input file
+ * @return Number of valid regions
+ * @throws std::runtime_error if the file cannot be read
+ */
+[[nodiscard]] int advent_of_code_2025_day12_part1(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day12_part1(read_input(file_path));
+}
+
+/**
+ * @brief Print how many regions each tier resolved.
+ *
+ * @param report Evaluated regions
+ */
+void print_tiers(const RegionReport &report)
+{
+    const auto resolved = [&](RegionTier tier)
+    { return report.resolved[static_cast<std::size_t>(tier)]; };
+
+    std::cout << "Resolved by tiling: " << resolved(RegionTier::FitsByTiling)
+              << ", by area: " << resolved(RegionTier::AreaExceeded)
+              << ", by search: " << resolved(RegionTier::FitsBySearch) + resolved(RegionTier::FailsBySearch)
+              << " (" << resolved(RegionTier::FitsBySearch) << " fit)" << std::endl;
+}
+
+} // namespace aoc2025::day12
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -471,19 +1079,28 @@ void remove_shape(std::vector<std::string> &grid, const Shape &shape, int row, i
  */
 int main()
 {
+    using namespace aoc2025::day12;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
         const std::filesystem::path input_file = "input.txt";
+        const std::filesystem::path cache_file = "region_cache.txt";
+
+        RegionCache cache = RegionCache::load(cache_file);
 
         std::cout << "=== Part 1: Present Fitting ===" << std::endl;
         std::cout << "--- input_example.txt ---" << std::endl;
-        const auto result1_example = advent_of_code_2025_day12_part1(example_file);
-        std::cout << "Valid regions: " << result1_example << std::endl;
+        const auto report_example = evaluate_regions(read_input(example_file), cache);
+        std::cout << "Valid regions: " << report_example.valid() << std::endl;
+        print_tiers(report_example);
 
         std::cout << "--- input.txt ---" << std::endl;
-        const auto result1 = advent_of_code_2025_day12_part1(input_file);
-        std::cout << "Valid regions: " << result1 << std::endl;
+        const auto report = evaluate_regions(read_input(input_file), cache);
+        std::cout << "Valid regions: " << report.valid() << std::endl;
+        print_tiers(report);
+
+        cache.save(cache_file);
     }
     catch (const std::exception &e)
     {
@@ -492,4 +1109,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
@@ -1,8 +1,6 @@
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <vector>
-#include <sstream>
 #include <optional>
 #include <filesystem>
 #include <string_view>
@@ -10,6 +8,12 @@
 #include <charconv>
 #include <stdexcept>
 
+#include "../../common/input.hpp"
+#include "../../common/solve.hpp"
+
+namespace aoc2025::day2
+{
+
 /**
  * @struct Range
  * @brief Represents a numeric range with start and end values.
@@ -82,29 +86,12 @@ struct Range
  */
 [[nodiscard]] std::vector<Range> read_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
+    const aoc::MappedFile file(file_path);
 
     std::vector<Range> path_ranges;
 
-    // Read entire file content
-    std::ostringstream buffer;
-    buffer << file.rdbuf();
-    const std::string content = buffer.str();
-
-    std::stringstream ss{content};
-    std::string range_str;
-
-    // Parse comma-separated ranges
-    while (std::getline(ss, range_str, ','))
+    // Parse comma-separated ranges straight out of the mapped file
+    for (const auto range_str : aoc::split(file.view(), ','))
     {
         const auto range = Range::from_string(range_str);
         if (range)
@@ -117,34 +104,73 @@ struct Range
     return path_ranges;
 }
 
+/// Wide accumulator for sums of many large IDs
+using WideSum = __int128;
+
+/// Longest ID that still fits in a long long (9'223'372'036'854'775'807 has 19 digits)
+constexpr int kMaxIdDigits = 19;
+
+/**
+ * @brief Compute 10 raised to a non-negative power.
+ *
+ * @param exponent Power of ten, at most 38
+ * @return 10^exponent
+ */
+[[nodiscard]] constexpr WideSum power_of_ten(int exponent) noexcept
+{
+    WideSum result = 1;
+    while (exponent-- > 0)
+    {
+        result *= 10;
+    }
+    return result;
+}
+
 /**
- * @brief Check if an ID is invalid (consists of two identical halves).
+ * @brief Sum IDs in a range that repeat one block of digits.
  *
- * An ID is considered invalid if it has an even number of digits and
- * the first half is identical to the second half. The first half cannot
- * start with zero.
+ * Every @p length digit ID made of a @p block digit pattern repeated
+ * length / block times equals pattern * (1 + 10^block + 10^(2*block) + ...).
+ * The patterns that land inside the range therefore form one contiguous
+ * interval, whose sum is an arithmetic series. A pattern cannot start with
+ * zero, so it is at least 10^(block-1).
  *
- * @param id The ID to check
- * @return true if the ID has repeating halves, false otherwise
+ * @param range Inclusive range of IDs
+ * @param length Number of digits of the ID (a multiple of @p block)
+ * @param block Number of digits of the repeated pattern
+ * @return The sum of all matching IDs in the range
  */
-[[nodiscard]] bool has_repeating_halves(const long long id) noexcept
+[[nodiscard]] constexpr WideSum sum_block_repetitions(const Range &range, int length, int block) noexcept
 {
-    const auto str = std::to_string(id);
-    const auto len = str.length();
+    const WideSum multiplier = (power_of_ten(length) - 1) / (power_of_ten(block) - 1);
 
-    // Must have an even number of digits
-    if (len % 2 != 0)
-        return false;
+    const WideSum first_pattern = std::max(power_of_ten(block - 1), (range.start + multiplier - 1) / multiplier);
+    const WideSum last_pattern = std::min(power_of_ten(block) - 1, range.end / multiplier);
 
-    const auto half = len / 2;
-    const std::string_view first_half(str.data(), half);
-    const std::string_view second_half(str.data() + half, half);
+    if (first_pattern > last_pattern)
+        return 0;
 
-    // First half cannot start with zero
-    if (first_half.front() == '0')
-        return false;
+    return multiplier * (first_pattern + last_pattern) * (last_pattern - first_pattern + 1) / 2;
+}
 
-    return first_half == second_half;
+/**
+ * @brief Sum IDs in a range that consist of two identical halves.
+ *
+ * Only even digit lengths can split into halves, and each length contributes
+ * one arithmetic series, so the cost depends on the number of digit lengths
+ * rather than on the width of the range.
+ *
+ * @param range Inclusive range of IDs
+ * @return The sum of all IDs with repeating halves
+ */
+[[nodiscard]] constexpr WideSum sum_repeating_halves(const Range &range) noexcept
+{
+    WideSum sum = 0;
+    for (int length = 2; length <= kMaxIdDigits; length += 2)
+    {
+        sum += sum_block_repetitions(range, length, length / 2);
+    }
+    return sum;
 }
 
 /**
@@ -153,80 +179,70 @@ struct Range
  * Calculates the sum of all invalid IDs within the given ranges.
  * An ID is invalid if it consists of two identical halves (e.g., 1212, 5555).
  *
- * @param file_path Path to the input file containing ranges
+ * @param ranges Parsed ID ranges
  * @return The sum of all invalid IDs
- * @throws std::runtime_error if the file cannot be read or contains invalid data
  */
-[[nodiscard]] long long advent_of_code_2025_day2_part1(const std::filesystem::path &file_path)
+[[nodiscard]] long long advent_of_code_2025_day2_part1(const std::vector<Range> &ranges)
 {
-    const auto ranges = read_input(file_path);
-    long long sum = 0LL;
+    WideSum sum = 0;
 
     for (const auto &range : ranges)
     {
-        for (long long id = range.start; id <= range.end; ++id)
-        {
-            if (has_repeating_halves(id))
-            {
-                sum += id;
-            }
-        }
+        sum += sum_repeating_halves(range);
     }
 
-    return sum;
+    return static_cast<long long>(sum);
 }
 
 /**
- * @brief Check if an ID consists of a repeating pattern (at least 2 times).
- *
- * An ID has a repeating pattern if it can be divided into identical segments
- * repeated at least twice. For example: 123123 (pattern: 123, repeated 2 times),
- * 77777 (pattern: 7, repeated 5 times). The pattern cannot start with zero.
+ * @brief Solve Advent of Code 2025 Day 2 Part 1 from an input file.
  *
- * @param id The ID to check
- * @return true if the ID contains a repeating pattern, false otherwise
+ * @param file_path Path to the input file containing ranges
+ * @return The sum of all invalid IDs
+ * @throws std::runtime_error if the file cannot be read or contains invalid data
  */
-[[nodiscard]] bool has_repeating_pattern(const long long id) noexcept
+[[nodiscard]] long long advent_of_code_2025_day2_part1(const std::filesystem::path &file_path)
 {
-    const auto str = std::to_string(id);
-    const auto len = str.length();
+    return advent_of_code_2025_day2_part1(read_input(file_path));
+}
 
-    // Check all possible pattern lengths (from 1 to len/2)
-    for (std::size_t pattern_len = 1; pattern_len <= len / 2; ++pattern_len)
+/**
+ * @brief Sum IDs in a range that repeat a pattern at least twice.
+ *
+ * An ID such as 1111 repeats several patterns (1 and 11), so summing every
+ * block length would count it more than once. Instead the sum is split by
+ * the shortest repeating block: for each block length in increasing order,
+ * the IDs whose shortest block divides it are removed from its series
+ * (inclusion-exclusion over the divisors of the digit length).
+ *
+ * @param range Inclusive range of IDs
+ * @return The sum of all IDs with repeating patterns
+ */
+[[nodiscard]] constexpr WideSum sum_repeating_patterns(const Range &range) noexcept
+{
+    WideSum sum = 0;
+    for (int length = 2; length <= kMaxIdDigits; ++length)
     {
-        // Check if number length is a multiple of pattern length
-        if (len % pattern_len != 0)
-            continue;
+        // primitive[block] = sum of IDs whose shortest repeating block has that many digits
+        WideSum primitive[kMaxIdDigits + 1] = {};
 
-        const std::string_view pattern(str.data(), pattern_len);
-
-        // Pattern cannot start with zero
-        if (pattern.front() == '0')
-            continue;
-
-        const auto repetitions = len / pattern_len;
-
-        // Must be repeated at least 2 times
-        if (repetitions < 2)
-            continue;
-
-        // Check if entire number consists of repetitions of this pattern
-        bool is_repeated = true;
-        for (std::size_t i = 1; i < repetitions; ++i)
+        for (int block = 1; block < length; ++block)
         {
-            const std::string_view segment(str.data() + i * pattern_len, pattern_len);
-            if (segment != pattern)
+            if (length % block != 0)
+                continue;
+
+            primitive[block] = sum_block_repetitions(range, length, block);
+            for (int divisor = 1; divisor < block; ++divisor)
             {
-                is_repeated = false;
-                break;
+                if (block % divisor == 0)
+                {
+                    primitive[block] -= primitive[divisor];
+                }
             }
+            sum += primitive[block];
         }
-
-        if (is_repeated)
-            return true;
     }
-
-    return false;
+    return sum;
 }
 
 /**
@@ -236,29 +252,55 @@ struct Range
  * An ID has a repeating pattern if it consists of identical segments repeated
  * at least twice (e.g., 123123, 77777, 454545).
  *
- * @param file_path Path to the input file containing ranges
+ * @param ranges Parsed ID ranges
  * @return The sum of all IDs with repeating patterns
- * @throws std::runtime_error if the file cannot be read or contains invalid data
  */
-[[nodiscard]] long long advent_of_code_2025_day2_part2(const std::filesystem::path &file_path)
+[[nodiscard]] long long advent_of_code_2025_day2_part2(const std::vector<Range> &ranges)
 {
-    const auto ranges = read_input(file_path);
-    long long sum = 0LL;
+    WideSum sum = 0;
 
     for (const auto &range : ranges)
     {
-        for (long long id = range.start; id <= range.end; ++id)
-        {
-            if (has_repeating_pattern(id))
-            {
-                sum += id;
-            }
-        }
+        sum += sum_repeating_patterns(range);
     }
 
-    return sum;
+    return static_cast<long long>(sum);
 }
 
+/**
+ * @brief Solve Advent of Code 2025 Day 2 Part 2 from an input file.
+ *
+ * @param file_path Path to the input file containing ranges
+ * @return The sum of all IDs with repeating patterns
+ * @throws std::runtime_error if the file cannot be read or contains invalid data
+ */
+[[nodiscard]] long long advent_of_code_2025_day2_part2(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day2_part2(read_input(file_path));
+}
+
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 2 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day2_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day2_part2(input); });
+}
+
+} // namespace aoc2025::day2
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -269,6 +311,8 @@ struct Range
  */
 int main()
 {
+    using namespace aoc2025::day2;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -276,20 +320,18 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day2_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Sum of invalid IDs: " << result1_example << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day2_part2(example_file);
         std::cout << "Sum of pattern IDs: " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day2_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Sum of invalid IDs: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day2_part2(input_file);
         std::cout << "Sum of pattern IDs: " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -299,4 +341,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
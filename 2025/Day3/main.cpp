@@ -1,121 +1,154 @@
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <vector>
+#include <array>
 #include <algorithm>
+#include <numeric>
 #include <filesystem>
 #include <string_view>
 #include <stdexcept>
 
+#include "../../common/input.hpp"
+#include "../../common/solve.hpp"
+#include "../../common/thread_pool.hpp"
+
+namespace aoc2025::day3
+{
+
 /**
  * @brief Read battery banks from an input file.
  *
- * Reads a file containing battery banks (one per line).
+ * Maps a file containing battery banks (one per line).
  * Each line represents a series of battery joltage digits.
  *
  * @param file_path Path to the input file
- * @return Vector of battery bank strings
+ * @return Views of the non-empty battery bank lines
  * @throws std::runtime_error if the file doesn't exist or cannot be opened
  */
-[[nodiscard]] std::vector<std::string> read_input(const std::filesystem::path &file_path)
+[[nodiscard]] aoc::InputLines read_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
+    return aoc::InputLines(file_path, true);
+}
+
+/**
+ * @brief Find maximum joltage by selecting K batteries from a bank in order.
+ *
+ * Single pass with a monotonic stack: a digit pops every smaller digit
+ * before it while enough later digits remain to refill the selection, so
+ * each battery is pushed and popped at most once, O(n) per bank. The
+ * selected digits are accumulated directly into an integer.
+ *
+ * @tparam K Number of batteries to select, at most 19 so the result fits 64 bits
+ * @param bank String of battery joltage digits
+ * @return Maximum joltage from K batteries, or 0 if the bank is shorter than K
+ */
+template <std::size_t K>
+[[nodiscard]] constexpr unsigned long long find_max_joltage(std::string_view bank) noexcept
+{
+    static_assert(K >= 1 && K <= 19, "K batteries must fit an unsigned 64-bit joltage");
 
-    std::ifstream file(file_path);
-    if (!file.is_open())
+    if (bank.length() < K)
     {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
+        return 0;
     }
 
-    std::vector<std::string> lines;
-    lines.reserve(200); // Reserve space based on typical input size
+    std::array<char, K> selected{};
+    std::size_t size = 0;
+    std::size_t drops = bank.length() - K; // batteries that may still be skipped
 
-    std::string line;
-    while (std::getline(file, line))
+    for (const char digit : bank)
     {
-        if (!line.empty())
+        while (size > 0 && drops > 0 && selected[size - 1] < digit)
         {
-            lines.push_back(std::move(line));
+            --size;
+            --drops;
+        }
+        if (size < K)
+        {
+            selected[size++] = digit;
+        }
+        else
+        {
+            --drops;
         }
     }
 
-    lines.shrink_to_fit();
-    return lines;
+    unsigned long long joltage = 0;
+    for (const char digit : selected)
+    {
+        joltage = joltage * 10 + static_cast<unsigned long long>(digit - '0');
+    }
+    return joltage;
 }
 
 /**
  * @brief Find maximum joltage by selecting any 2 batteries from a bank.
  *
- * Checks all possible pairs of two batteries and finds the maximum
- * joltage value that can be formed by concatenating their digits.
- *
  * @param bank String of battery joltage digits
  * @return Maximum joltage value from selecting 2 batteries
  */
 [[nodiscard]] constexpr int find_max_joltage(std::string_view bank) noexcept
 {
-    int max_joltage = 0;
-    const auto len = bank.length();
-
-    // Check all possible pairs of two batteries
-    for (std::size_t i = 0; i < len; ++i)
-    {
-        for (std::size_t j = i + 1; j < len; ++j)
-        {
-            // Create a number from two selected digits
-            const int joltage = (bank[i] - '0') * 10 + (bank[j] - '0');
-            max_joltage = std::max(max_joltage, joltage);
-        }
-    }
-
-    return max_joltage;
+    return static_cast<int>(find_max_joltage<2>(bank));
 }
 
+static_assert(find_max_joltage("987654321111111") == 98);
+static_assert(find_max_joltage<12>("818181911112111") == 888911112111ULL);
+
 /**
- * @brief Find maximum joltage by selecting exactly 12 batteries from a bank.
+ * @brief Sum the K-battery joltages of all banks.
  *
- * Uses a greedy algorithm to find the largest number that can be formed
- * by selecting 12 batteries in order (maintaining their relative positions).
+ * Large inputs are split into contiguous ranges of banks summed on a
+ * thread pool; small ones are summed inline, where thread start-up would
+ * cost more than the scan.
  *
- * @param bank String of battery joltage digits
- * @return Maximum joltage value from selecting 12 batteries in order
+ * @tparam K Number of batteries to select per bank
+ * @param banks Battery bank strings
+ * @return Sum of the maximum joltages
  */
-[[nodiscard]] long long find_max_joltage_12_batteries(std::string_view bank)
+template <std::size_t K>
+[[nodiscard]] long long sum_max_joltage(const aoc::InputLines &banks)
 {
-    constexpr std::size_t kBatteriesToSelect = 12;
-    const auto len = bank.length();
-    std::string result;
-    result.reserve(kBatteriesToSelect);
-
-    // Greedy algorithm: for each position in result, select the largest possible digit
-    std::size_t start_pos = 0;
-    for (std::size_t i = 0; i < kBatteriesToSelect; ++i)
-    {
-        // How many digits do we still need to select after this position?
-        const auto remaining = kBatteriesToSelect - i - 1;
-
-        // Find the largest digit in range that allows selecting remaining digits later
-        char max_digit = '0';
-        std::size_t max_pos = start_pos;
+    constexpr std::size_t kParallelBytes = std::size_t{1} << 20;
 
-        // Search from start_pos to position that leaves enough digits
-        for (std::size_t j = start_pos; j <= len - remaining - 1; ++j)
+    const auto sum_range = [&banks](std::size_t first, std::size_t last)
+    {
+        unsigned long long total = 0;
+        for (std::size_t i = first; i < last; ++i)
         {
-            if (bank[j] > max_digit)
-            {
-                max_digit = bank[j];
-                max_pos = j;
-            }
+            total += find_max_joltage<K>(banks[i]);
         }
+        return total;
+    };
 
-        result += max_digit;
-        start_pos = max_pos + 1;
+    std::size_t bytes = 0;
+    for (const auto bank : banks)
+    {
+        bytes += bank.size();
+    }
+
+    if (bytes < kParallelBytes || banks.size() < 2)
+    {
+        return static_cast<long long>(sum_range(0, banks.size()));
+    }
+    const unsigned threads = aoc::ThreadBudget::threads();
+    if (threads < 2)
+    {
+        return static_cast<long long>(sum_range(0, banks.size()));
     }
 
-    return std::stoll(result);
+    const std::size_t chunks = std::min<std::size_t>(banks.size(), threads);
+    std::vector<unsigned long long> partial(chunks, 0);
+    {
+        aoc::ThreadPool pool(threads);
+        for (std::size_t c = 0; c < chunks; ++c)
+        {
+            pool.submit([&, c]
+                        { partial[c] = sum_range(banks.size() * c / chunks, banks.size() * (c + 1) / chunks); });
+        }
+        pool.wait();
+    }
+    return static_cast<long long>(std::accumulate(partial.begin(), partial.end(), 0ULL));
 }
 
 /**
@@ -124,21 +157,24 @@
  * Calculates the sum of maximum joltages from each battery bank,
  * where each bank contributes its maximum 2-battery joltage.
  *
+ * @param banks Battery bank strings
+ * @return Sum of all maximum 2-battery joltages
+ */
+[[nodiscard]] long long advent_of_code_2025_day3_part1(const aoc::InputLines &banks)
+{
+    return sum_max_joltage<2>(banks);
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 3 Part 1 from an input file.
+ *
  * @param file_path Path to the input file containing battery banks
  * @return Sum of all maximum 2-battery joltages
  * @throws std::runtime_error if the file cannot be read
  */
 [[nodiscard]] long long advent_of_code_2025_day3_part1(const std::filesystem::path &file_path)
 {
-    const auto banks = read_input(file_path);
-    long long total_joltage = 0;
-
-    for (const auto &bank : banks)
-    {
-        total_joltage += find_max_joltage(bank);
-    }
-
-    return total_joltage;
+    return advent_of_code_2025_day3_part1(read_input(file_path));
 }
 
 /**
@@ -147,23 +183,48 @@
  * Calculates the sum of maximum joltages from each battery bank,
  * where each bank contributes its maximum 12-battery joltage.
  *
+ * @param banks Battery bank strings
+ * @return Sum of all maximum 12-battery joltages
+ */
+[[nodiscard]] long long advent_of_code_2025_day3_part2(const aoc::InputLines &banks)
+{
+    return sum_max_joltage<12>(banks);
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 3 Part 2 from an input file.
+ *
  * @param file_path Path to the input file containing battery banks
  * @return Sum of all maximum 12-battery joltages
  * @throws std::runtime_error if the file cannot be read
  */
 [[nodiscard]] long long advent_of_code_2025_day3_part2(const std::filesystem::path &file_path)
 {
-    const auto banks = read_input(file_path);
-    long long total_joltage = 0;
-
-    for (const auto &bank : banks)
-    {
-        total_joltage += find_max_joltage_12_batteries(bank);
-    }
+    return advent_of_code_2025_day3_part2(read_input(file_path));
+}
 
-    return total_joltage;
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 3 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day3_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day3_part2(input); });
 }
 
+} // namespace aoc2025::day3
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -174,6 +235,8 @@
  */
 int main()
 {
+    using namespace aoc2025::day3;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -181,20 +244,18 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day3_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Max joltage sum: " << result1_example << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day3_part2(example_file);
         std::cout << "Max joltage sum (12 batteries): " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day3_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Max joltage sum: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day3_part2(input_file);
         std::cout << "Max joltage sum (12 batteries): " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -204,4 +265,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
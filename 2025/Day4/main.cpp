@@ -1,49 +1,31 @@
 #include <iostream>
-#include <fstream>
 #include <vector>
-#include <string>
 #include <array>
+#include <cstdint>
 #include <filesystem>
 #include <stdexcept>
-#include <utility>
+
+#include "../../common/grid.hpp"
+#include "../../common/input.hpp"
+#include "../../common/solve.hpp"
+
+namespace aoc2025::day4
+{
 
 /**
  * @brief Read grid from an input file.
  *
- * Reads a file containing a grid (one line per row).
- * Empty lines are skipped.
+ * Reads a file containing a grid (one line per row) into a padded byte
+ * plane with 1 for every roll ('@'). Empty lines are skipped.
  *
  * @param file_path Path to the input file
- * @return Vector of strings representing the grid
+ * @return Plane of roll cells
  * @throws std::runtime_error if the file doesn't exist or cannot be opened
  */
-[[nodiscard]] std::vector<std::string> read_input(const std::filesystem::path &file_path)
+[[nodiscard]] aoc::BytePlane read_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
-
-    std::vector<std::string> grid;
-    grid.reserve(100);
-
-    std::string line;
-    while (std::getline(file, line))
-    {
-        if (!line.empty())
-        {
-            grid.push_back(std::move(line));
-        }
-    }
-
-    grid.shrink_to_fit();
-    return grid;
+    const aoc::InputLines lines(file_path, true);
+    return aoc::BytePlane::from_lines(lines, '@');
 }
 
 /**
@@ -51,67 +33,42 @@
  *
  * Counts accessible rolls (marked with '@') in the grid.
  * A roll is accessible if it has fewer than 4 adjacent rolls.
+ * All neighbour counts come from one vectorized 3x3 stencil pass.
  *
- * @param file_path Path to the input file containing the grid
+ * @param grid Plane of roll cells
  * @return Number of accessible rolls
- * @throws std::runtime_error if the file cannot be read
  */
-[[nodiscard]] int advent_of_code_2025_day4_part1(const std::filesystem::path &file_path)
+[[nodiscard]] int advent_of_code_2025_day4_part1(const aoc::BytePlane &grid)
 {
-    const auto grid = read_input(file_path);
-
-    if (grid.empty())
-    {
-        return 0;
-    }
-
-    const int rows = static_cast<int>(grid.size());
-    const int cols = static_cast<int>(grid[0].size());
-
-    // Define 8 directions: N, NE, E, SE, S, SW, W, NW
-    constexpr std::array<int, 8> dx = {-1, -1, 0, 1, 1, 1, 0, -1};
-    constexpr std::array<int, 8> dy = {0, 1, 1, 1, 0, -1, -1, -1};
+    const aoc::BytePlane adjacent = grid.neighbour_counts();
 
     int accessibleCount = 0;
-
-    // Check each position
-    for (int i = 0; i < rows; ++i)
+    for (int i = 0; i < grid.rows(); ++i)
     {
-        for (int j = 0; j < cols; ++j)
+        const std::uint8_t *rolls = grid.row(i);
+        const std::uint8_t *counts = adjacent.row(i);
+        for (int j = 0; j < grid.cols(); ++j)
         {
-            // Only check positions with '@'
-            if (grid[i][j] == '@')
-            {
-                int adjacentRolls = 0;
-
-                // Check all 8 adjacent positions
-                for (int dir = 0; dir < 8; ++dir)
-                {
-                    int ni = i + dx[dir];
-                    int nj = j + dy[dir];
-
-                    // Check if position is within bounds
-                    if (ni >= 0 && ni < rows && nj >= 0 && nj < cols)
-                    {
-                        if (grid[ni][nj] == '@')
-                        {
-                            adjacentRolls++;
-                        }
-                    }
-                }
-
-                // A roll is accessible if there are fewer than 4 adjacent rolls
-                if (adjacentRolls < 4)
-                {
-                    accessibleCount++;
-                }
-            }
+            // A roll is accessible if there are fewer than 4 adjacent rolls
+            accessibleCount += rolls[j] & (counts[j] < 4);
         }
     }
 
     return accessibleCount;
 }
 
+/**
+ * @brief Solve Advent of Code 2025 Day 4 Part 1 from an input file.
+ *
+ * @param file_path Path to the input file containing the grid
+ * @return Number of accessible rolls
+ * @throws std::runtime_error if the file cannot be read
+ */
+[[nodiscard]] int advent_of_code_2025_day4_part1(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day4_part1(read_input(file_path));
+}
+
 /**
  * @brief Solve Advent of Code 2025 Day 4 Part 2.
  *
@@ -119,85 +76,95 @@
  * Keeps removing accessible rolls until no more can be removed.
  * A roll is accessible if it has fewer than 4 adjacent rolls.
  *
- * @param file_path Path to the input file containing the grid
+ * Neighbour counts can only go down, so the order of removals does not
+ * change the result. Counts are computed once with the stencil, and every
+ * removal decrements its neighbours; a roll joins the worklist exactly when
+ * its count drops below 4. Total work is proportional to the grid size plus
+ * the number of removals.
+ *
+ * @param grid Plane of roll cells
  * @return Total number of rolls removed
- * @throws std::runtime_error if the file cannot be read
  */
-[[nodiscard]] int advent_of_code_2025_day4_part2(const std::filesystem::path &file_path)
+[[nodiscard]] int advent_of_code_2025_day4_part2(const aoc::BytePlane &grid)
 {
-    auto grid = read_input(file_path);
+    aoc::BytePlane rolls = grid;
+    aoc::BytePlane adjacent = grid.neighbour_counts();
+    std::uint8_t *roll = rolls.data();
+    std::uint8_t *count = adjacent.data();
 
-    if (grid.empty())
-    {
-        return 0;
-    }
-
-    const int rows = static_cast<int>(grid.size());
-    const int cols = static_cast<int>(grid[0].size());
-
-    // Define 8 directions: N, NE, E, SE, S, SW, W, NW
-    constexpr std::array<int, 8> dx = {-1, -1, 0, 1, 1, 1, 0, -1};
-    constexpr std::array<int, 8> dy = {0, 1, 1, 1, 0, -1, -1, -1};
-
-    int totalRemoved = 0;
-    bool changed = true;
+    // N, NE, E, SE, S, SW, W, NW as flat offsets; the border makes bounds checks unnecessary
+    const int stride = grid.stride();
+    const std::array<int, 8> offsets = {-stride, -stride + 1, 1, stride + 1, stride, stride - 1, -1, -stride - 1};
 
-    // Keep removing accessible rolls until no more can be removed
-    while (changed)
+    std::vector<int> worklist;
+    for (int i = 0; i < grid.rows(); ++i)
     {
-        changed = false;
-        std::vector<std::pair<int, int>> toRemove;
-
-        // Find all accessible rolls in current iteration
-        for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < grid.cols(); ++j)
         {
-            for (int j = 0; j < cols; ++j)
+            const int cell = static_cast<int>(grid.index(i, j));
+            if (roll[cell] && count[cell] < 4)
             {
-                // Only check positions with '@'
-                if (grid[i][j] == '@')
-                {
-                    int adjacentRolls = 0;
-
-                    // Check all 8 adjacent positions
-                    for (int dir = 0; dir < 8; ++dir)
-                    {
-                        int ni = i + dx[dir];
-                        int nj = j + dy[dir];
-
-                        // Check if position is within bounds
-                        if (ni >= 0 && ni < rows && nj >= 0 && nj < cols)
-                        {
-                            if (grid[ni][nj] == '@')
-                            {
-                                adjacentRolls++;
-                            }
-                        }
-                    }
-
-                    // A roll is accessible if there are fewer than 4 adjacent rolls
-                    if (adjacentRolls < 4)
-                    {
-                        toRemove.push_back({i, j});
-                    }
-                }
+                worklist.push_back(cell);
             }
         }
+    }
+
+    int totalRemoved = 0;
+    while (!worklist.empty())
+    {
+        const int cell = worklist.back();
+        worklist.pop_back();
 
-        // Remove all accessible rolls
-        if (!toRemove.empty())
+        roll[cell] = 0;
+        totalRemoved++;
+
+        for (const int offset : offsets)
         {
-            for (const auto &pos : toRemove)
+            const int neighbour = cell + offset;
+            if (roll[neighbour] && --count[neighbour] == 3)
             {
-                grid[pos.first][pos.second] = '.';
-                totalRemoved++;
+                worklist.push_back(neighbour);
             }
-            changed = true;
         }
     }
 
     return totalRemoved;
 }
 
+/**
+ * @brief Solve Advent of Code 2025 Day 4 Part 2 from an input file.
+ *
+ * @param file_path Path to the input file containing the grid
+ * @return Total number of rolls removed
+ * @throws std::runtime_error if the file cannot be read
+ */
+[[nodiscard]] int advent_of_code_2025_day4_part2(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day4_part2(read_input(file_path));
+}
+
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 4 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day4_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day4_part2(input); });
+}
+
+} // namespace aoc2025::day4
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -208,6 +175,8 @@
  */
 int main()
 {
+    using namespace aoc2025::day4;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -215,20 +184,18 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day4_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Accessible rolls: " << result1_example << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day4_part2(example_file);
         std::cout << "Total rolls removed: " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day4_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Accessible rolls: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day4_part2(input_file);
         std::cout << "Total rolls removed: " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -238,4 +205,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
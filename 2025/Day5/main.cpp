@@ -1,12 +1,16 @@
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <vector>
-#include <sstream>
-#include <algorithm>
 #include <filesystem>
 #include <stdexcept>
-#include <utility>
+
+#include "../../common/input.hpp"
+#include "../../common/parse_cache.hpp"
+#include "../../common/solve.hpp"
+#include "../../common/interval_set.hpp"
+
+namespace aoc2025::day5
+{
 
 /**
  * @struct Range
@@ -24,7 +28,7 @@ struct Range
  */
 struct InputData
 {
-    std::vector<Range> freshRanges;      /// Ranges of fresh ingredient IDs
+    aoc::IntervalSet<long long> fresh;   /// Fresh ingredient ID ranges, merged once for both parts
     std::vector<long long> availableIds; /// Available ingredient IDs
 };
 
@@ -40,28 +44,19 @@ struct InputData
  * @return InputData structure with parsed ranges and IDs
  * @throws std::runtime_error if the file doesn't exist or cannot be opened
  */
-[[nodiscard]] InputData read_input(const std::filesystem::path &file_path)
+[[nodiscard]] InputData parse_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
+    const aoc::MappedFile file(file_path);
 
     InputData data;
-    data.freshRanges.reserve(50);
+    std::vector<Range> freshRanges;
+    freshRanges.reserve(50);
     data.availableIds.reserve(100);
 
-    std::string line;
     bool readingRanges = true;
 
     // Read fresh ingredient ID ranges
-    while (std::getline(file, line))
+    for (const auto line : aoc::lines(file.view()))
     {
         if (line.empty())
         {
@@ -73,30 +68,82 @@ struct InputData
         {
             // Parse range (e.g., "3-5")
             const size_t dashPos = line.find('-');
-            if (dashPos != std::string::npos)
+            if (dashPos != std::string_view::npos)
             {
-                const long long start = std::stoll(line.substr(0, dashPos));
-                const long long end = std::stoll(line.substr(dashPos + 1));
-                data.freshRanges.push_back({start, end});
+                const long long start = aoc::parse_int<long long>(line.substr(0, dashPos));
+                const long long end = aoc::parse_int<long long>(line.substr(dashPos + 1));
+                freshRanges.push_back({start, end});
             }
         }
         else
         {
             // Parse available ingredient ID
-            data.availableIds.push_back(std::stoll(line));
+            data.availableIds.push_back(aoc::parse_int<long long>(line));
         }
     }
 
-    data.freshRanges.shrink_to_fit();
+    data.fresh = aoc::IntervalSet<long long>(freshRanges);
     data.availableIds.shrink_to_fit();
     return data;
 }
 
+/// Layout of InputData in the parse cache; bump when save() changes
+inline constexpr std::uint32_t kCacheSchema = 20250502;
+
+/**
+ * @brief Serialize parsed input for the parse cache.
+ * @param writer Destination
+ * @param data Parsed input
+ */
+void save(aoc::BinaryWriter &writer, const InputData &data)
+{
+    save(writer, data.fresh);
+    writer.write_vector(data.availableIds);
+}
+
+/**
+ * @brief Deserialize parsed input written by save().
+ *
+ * @param reader Source
+ * @param data Receives the parsed input
+ * @throws std::runtime_error if the data is truncated
+ */
+void load(aoc::BinaryReader &reader, InputData &data)
+{
+    load(reader, data.fresh);
+    data.availableIds = reader.read_vector<long long>();
+}
+
+/**
+ * @brief Read input data from a file, through the parse cache when it is enabled.
+ *
+ * @param file_path Path to the input file
+ * @return InputData structure with parsed ranges and IDs
+ * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ */
+[[nodiscard]] InputData read_input(const std::filesystem::path &file_path)
+{
+    return aoc::parse_cache::load_or_parse<InputData>(file_path, kCacheSchema, parse_input);
+}
+
 /**
  * @brief Solve Advent of Code 2025 Day 5 Part 1.
  *
  * Counts how many available ingredient IDs are considered fresh
- * (fall within any of the fresh ingredient ID ranges).
+ * (fall within any of the fresh ingredient ID ranges). The ranges were
+ * merged into an interval index while parsing, so each lookup is a binary
+ * search.
+ *
+ * @param data Parsed ranges and available IDs
+ * @return Number of fresh ingredient IDs
+ */
+[[nodiscard]] int advent_of_code_2025_day5_part1(const InputData &data)
+{
+    return static_cast<int>(data.fresh.count_contained(data.availableIds.begin(), data.availableIds.end()));
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 5 Part 1 from an input file.
  *
  * @param file_path Path to the input file
  * @return Number of fresh ingredient IDs
@@ -104,24 +151,7 @@ struct InputData
  */
 [[nodiscard]] int advent_of_code_2025_day5_part1(const std::filesystem::path &file_path)
 {
-    const auto data = read_input(file_path);
-
-    // Check which available IDs are fresh
-    int freshCount = 0;
-    for (const long long id : data.availableIds)
-    {
-        const bool isFresh = std::any_of(data.freshRanges.begin(), data.freshRanges.end(),
-                                          [id](const Range &range)
-                                          {
-                                              return id >= range.start && id <= range.end;
-                                          });
-        if (isFresh)
-        {
-            freshCount++;
-        }
-    }
-
-    return freshCount;
+    return advent_of_code_2025_day5_part1(read_input(file_path));
 }
 
 /**
@@ -130,47 +160,49 @@ struct InputData
  * Calculates the total number of unique ingredient IDs considered fresh
  * by merging overlapping or adjacent ranges.
  *
+ * @param data Parsed ranges and available IDs
+ * @return Total number of fresh ingredient IDs
+ */
+[[nodiscard]] long long advent_of_code_2025_day5_part2(const InputData &data)
+{
+    // Merging overlapping or adjacent ranges leaves each fresh ID counted once
+    return data.fresh.cardinality();
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 5 Part 2 from an input file.
+ *
  * @param file_path Path to the input file
  * @return Total number of fresh ingredient IDs
  * @throws std::runtime_error if the file cannot be read
  */
 [[nodiscard]] long long advent_of_code_2025_day5_part2(const std::filesystem::path &file_path)
 {
-    const auto data = read_input(file_path);
-    auto freshRanges = data.freshRanges;
-
-    // Merge overlapping ranges to count total unique IDs
-    // First, sort ranges by start position
-    std::sort(freshRanges.begin(), freshRanges.end(),
-              [](const Range &a, const Range &b)
-              { return a.start < b.start; });
-
-    // Merge overlapping or adjacent ranges
-    std::vector<Range> mergedRanges;
-    for (const auto &range : freshRanges)
-    {
-        if (mergedRanges.empty() || mergedRanges.back().end < range.start - 1)
-        {
-            // No overlap, add new range
-            mergedRanges.push_back(range);
-        }
-        else
-        {
-            // Overlap or adjacent, merge
-            mergedRanges.back().end = std::max(mergedRanges.back().end, range.end);
-        }
-    }
-
-    // Count total IDs in merged ranges
-    long long totalFreshIds = 0;
-    for (const auto &range : mergedRanges)
-    {
-        totalFreshIds += (range.end - range.start + 1);
-    }
+    return advent_of_code_2025_day5_part2(read_input(file_path));
+}
 
-    return totalFreshIds;
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 5 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day5_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day5_part2(input); });
 }
 
+} // namespace aoc2025::day5
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -181,6 +213,8 @@ struct InputData
  */
 int main()
 {
+    using namespace aoc2025::day5;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -188,20 +222,18 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day5_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Number of fresh ingredient IDs: " << result1_example << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day5_part2(example_file);
         std::cout << "Total ingredient IDs considered fresh: " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day5_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Number of fresh ingredient IDs: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day5_part2(input_file);
         std::cout << "Total ingredient IDs considered fresh: " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -211,4 +243,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
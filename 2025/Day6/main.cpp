@@ -1,341 +1,329 @@
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <vector>
-#include <sstream>
 #include <filesystem>
 #include <stdexcept>
 #include <algorithm>
+#include <string_view>
 
-/**
- * @struct Problem
- * @brief Represents a mathematical problem with numbers and an operation.
- */
-struct Problem
+#include "../../common/input.hpp"
+#include "../../common/solve.hpp"
+
+namespace aoc2025::day6
 {
-    std::vector<long long> numbers; ///< Numbers in the problem
-    char operation;                 ///< Operation to perform ('*' or '+')
-};
 
 /**
- * @brief Read worksheet problems from input file (horizontal reading).
- *
- * Reads problems arranged horizontally, parsing each column as a problem.
+ * @class Worksheet
+ * @brief Column-major copy of a worksheet's digit rows plus its operator row.
  *
- * @param file_path Path to the input file
- * @return Vector of Problem structures
- * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ * The operator row (the last line) is kept as is. The digit rows above it are
+ * transposed into one contiguous buffer, column after column, so every
+ * column's digits are adjacent in memory however wide the sheet is. Short rows
+ * are padded with spaces.
  */
-[[nodiscard]] std::vector<Problem> read_input(const std::filesystem::path &file_path)
+class Worksheet
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
+public:
+    /**
+     * @brief Transpose worksheet rows.
+     *
+     * Rows are copied in blocks of kBlockColumns columns so that both the
+     * row reads and the column-major writes of a block stay in cache.
+     *
+     * @param lines Worksheet rows; the last one holds the operators
+     */
+    explicit Worksheet(const aoc::InputLines &lines)
     {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
-    std::vector<std::string> lines;
-    std::string line;
-
-    // Read all lines
-    while (std::getline(file, line))
-    {
-        lines.push_back(line);
-    }
-
-    if (lines.empty())
-        return {};
-
-    // Find the width of the worksheet
-    int max_width = 0;
-    for (const auto &l : lines)
-    {
-        max_width = std::max(max_width, (int)l.length());
-    }
-
-    // Parse problems column by column
-    std::vector<Problem> problems;
-
-    for (int col = 0; col < max_width; ++col)
-    {
-        // Check if this column starts a problem (has non-space content)
-        bool has_content = false;
-        for (int row = 0; row < lines.size(); ++row)
+        if (lines.empty())
         {
-            if (col < lines[row].length() && lines[row][col] != ' ')
-            {
-                has_content = true;
-                break;
-            }
+            return;
         }
 
-        if (!has_content)
-            continue;
-
-        // Find the extent of this problem (until we hit a column of all spaces)
-        int end_col = col;
-        while (end_col < max_width)
+        rows_ = static_cast<int>(lines.size()) - 1;
+        for (const auto line : lines)
         {
-            bool all_spaces = true;
-            for (int row = 0; row < lines.size(); ++row)
-            {
-                if (end_col < lines[row].length() && lines[row][end_col] != ' ')
-                {
-                    all_spaces = false;
-                    break;
-                }
-            }
-            if (all_spaces)
-                break;
-            end_col++;
+            width_ = std::max(width_, static_cast<int>(line.size()));
         }
 
-        // Extract this problem
-        Problem prob;
-        std::string number_str = "";
+        operators_.assign(width_, ' ');
+        const std::string_view operatorRow = lines[lines.size() - 1];
+        std::copy(operatorRow.begin(), operatorRow.end(), operators_.begin());
 
-        for (int row = 0; row < lines.size(); ++row)
+        constexpr int kBlockColumns = 256;
+        columns_.assign(static_cast<size_t>(width_) * rows_, ' ');
+        for (int block = 0; block < width_; block += kBlockColumns)
         {
-            std::string segment = "";
-            for (int c = col; c < end_col && c < lines[row].length(); ++c)
-            {
-                segment += lines[row][c];
-            }
-
-            // Trim segment
-            size_t start = segment.find_first_not_of(' ');
-            size_t end = segment.find_last_not_of(' ');
-            if (start != std::string::npos)
-            {
-                segment = segment.substr(start, end - start + 1);
-            }
-            else
-            {
-                segment = "";
-            }
-
-            if (!segment.empty())
+            for (int row = 0; row < rows_; ++row)
             {
-                if (segment == "*" || segment == "+")
+                const std::string_view line = lines[row];
+                const int blockEnd = std::min<int>(block + kBlockColumns, static_cast<int>(line.size()));
+                for (int col = block; col < blockEnd; ++col)
                 {
-                    prob.operation = segment[0];
-                }
-                else
-                {
-                    prob.numbers.push_back(std::stoll(segment));
+                    columns_[static_cast<size_t>(col) * rows_ + row] = line[col];
                 }
             }
         }
 
-        if (!prob.numbers.empty())
+        blank_.resize(width_);
+        for (int col = 0; col < width_; ++col)
         {
-            problems.push_back(prob);
+            blank_[col] = operators_[col] == ' ' && column(col).find_first_not_of(' ') == std::string_view::npos;
         }
+    }
 
-        col = end_col; // Skip to next problem
+    /**
+     * @brief Get the number of digit rows.
+     * @return Rows above the operator row
+     */
+    [[nodiscard]] int rows() const noexcept { return rows_; }
+
+    /**
+     * @brief Get the number of columns.
+     * @return Width of the widest row
+     */
+    [[nodiscard]] int width() const noexcept { return width_; }
+
+    /**
+     * @brief Get the digit cells of a column, top to bottom.
+     *
+     * @param col Column index
+     * @return View of rows() characters
+     */
+    [[nodiscard]] std::string_view column(int col) const noexcept
+    {
+        return {columns_.data() + static_cast<size_t>(col) * rows_, static_cast<size_t>(rows_)};
     }
 
-    return problems;
-}
+    /**
+     * @brief Get the operator row cell of a column.
+     *
+     * @param col Column index
+     * @return '+', '*' or a space
+     */
+    [[nodiscard]] char operation(int col) const noexcept { return operators_[col]; }
+
+    /**
+     * @brief Check whether a column separates two problems.
+     *
+     * @param col Column index
+     * @return True if neither the digit rows nor the operator row hold anything
+     */
+    [[nodiscard]] bool blank(int col) const noexcept { return blank_[col] != 0; }
+
+private:
+    int rows_ = 0;                     ///< Digit rows
+    int width_ = 0;                    ///< Columns
+    std::string operators_;            ///< Operator row padded to width_
+    std::vector<char> columns_;        ///< Digit cells, column-major
+    std::vector<unsigned char> blank_; ///< Non-zero for separator columns
+};
 
 /**
- * @brief Read worksheet problems from input file (vertical reading).
- *
- * Reads problems arranged horizontally, but reads digits vertically.
- * Each column represents a digit read from top to bottom.
+ * @brief Read a worksheet from an input file.
  *
  * @param file_path Path to the input file
- * @return Vector of Problem structures
+ * @return Transposed worksheet
  * @throws std::runtime_error if the file doesn't exist or cannot be opened
  */
-[[nodiscard]] std::vector<Problem> read_input_vertical(const std::filesystem::path &file_path)
+[[nodiscard]] Worksheet read_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
-
-    std::vector<std::string> lines;
-    std::string line;
-
-    while (std::getline(file, line))
-    {
-        lines.push_back(line);
-    }
-
-    if (lines.empty())
-        return {};
-
-    int max_width = 0;
-    for (const auto &l : lines)
-    {
-        max_width = std::max(max_width, (int)l.length());
-    }
-
-    std::vector<Problem> problems;
+    // Map the file once; rows are views into it
+    return Worksheet(aoc::InputLines(file_path, true));
+}
 
-    for (int col = 0; col < max_width; ++col)
+/**
+ * @brief Call a visitor for every problem of a worksheet, left to right.
+ *
+ * A problem is a run of non-blank columns; its operation is the operator
+ * row symbol found in that run.
+ *
+ * @param sheet Worksheet to scan
+ * @param visit Callable taking (first column, one past last column, operation)
+ * @throws std::runtime_error if a problem has no operation
+ */
+template <typename Visit>
+void for_each_problem(const Worksheet &sheet, Visit &&visit)
+{
+    for (int col = 0; col < sheet.width(); ++col)
     {
-        bool has_content = false;
-        for (int row = 0; row < lines.size(); ++row)
-        {
-            if (col < lines[row].length() && lines[row][col] != ' ')
-            {
-                has_content = true;
-                break;
-            }
-        }
-
-        if (!has_content)
+        if (sheet.blank(col))
             continue;
 
+        char operation = ' ';
         int end_col = col;
-        while (end_col < max_width)
+        while (end_col < sheet.width() && !sheet.blank(end_col))
         {
-            bool all_spaces = true;
-            for (int row = 0; row < lines.size(); ++row)
+            if (sheet.operation(end_col) != ' ')
             {
-                if (end_col < lines[row].length() && lines[row][end_col] != ' ')
-                {
-                    all_spaces = false;
-                    break;
-                }
+                operation = sheet.operation(end_col);
             }
-            if (all_spaces)
-                break;
             end_col++;
         }
 
-        Problem prob;
-
-        for (int c = end_col - 1; c >= col; --c)
+        if (operation != '*' && operation != '+')
         {
-            std::string digit_str = "";
-            char operation_char = ' ';
-
-            for (int row = 0; row < lines.size(); ++row)
-            {
-                if (c < lines[row].length() && lines[row][c] != ' ')
-                {
-                    char ch = lines[row][c];
-                    if (ch == '*' || ch == '+')
-                    {
-                        operation_char = ch;
-                    }
-                    else
-                    {
-                        digit_str += ch;
-                    }
-                }
-            }
-
-            if (!digit_str.empty())
-            {
-                long long number = std::stoll(digit_str);
-                prob.numbers.push_back(number);
-            }
-
-            if (operation_char != ' ')
-            {
-                prob.operation = operation_char;
-            }
-        }
-
-        if (!prob.numbers.empty())
-        {
-            problems.push_back(prob);
+            throw std::runtime_error("No operation for problem at column " + std::to_string(col));
         }
 
-        col = end_col;
+        visit(col, end_col, operation);
+        col = end_col; // Skip to next problem
     }
+}
 
-    return problems;
+/**
+ * @brief Add a digit cell to a number being read.
+ *
+ * @param number Number read so far
+ * @param cell Worksheet cell, a digit or a space
+ * @return Updated number
+ * @throws std::runtime_error if the cell is neither a digit nor a space
+ */
+[[nodiscard]] long long append_digit(long long number, char cell)
+{
+    if (cell == ' ')
+    {
+        return number;
+    }
+    if (cell < '0' || cell > '9')
+    {
+        throw std::runtime_error(std::string("Invalid worksheet character: ") + cell);
+    }
+    return number * 10 + (cell - '0');
 }
 
 /**
  * @brief Solve Advent of Code 2025 Day 6 Part 1.
  *
- * Reads worksheet problems horizontally and calculates results.
+ * Reads worksheet problems horizontally: each digit row of a problem is
+ * one number. The numbers of all rows are built at once while the
+ * problem's columns are walked, in one scratch buffer reused for every
+ * problem.
  *
- * @param file_path Path to the input file
+ * @param sheet Parsed worksheet
  * @return Grand total of all problem results
- * @throws std::runtime_error if the file cannot be read
+ * @throws std::runtime_error if the worksheet is malformed
  */
-[[nodiscard]] long long advent_of_code_2025_day6_part1(const std::filesystem::path &file_path)
+[[nodiscard]] long long advent_of_code_2025_day6_part1(const Worksheet &sheet)
 {
-    const auto problems = read_input(file_path);
-
     long long grand_total = 0;
-
-    for (const auto &prob : problems)
-    {
-        long long result = prob.numbers[0];
-
-        for (int i = 1; i < prob.numbers.size(); ++i)
+    std::vector<long long> numbers(sheet.rows());
+    std::vector<unsigned char> present(sheet.rows());
+
+    for_each_problem(sheet, [&](int col, int end_col, char operation)
+                     {
+        std::fill(numbers.begin(), numbers.end(), 0);
+        std::fill(present.begin(), present.end(), 0);
+        for (int c = col; c < end_col; ++c)
         {
-            if (prob.operation == '*')
+            const std::string_view cells = sheet.column(c);
+            for (size_t row = 0; row < cells.size(); ++row)
             {
-                result *= prob.numbers[i];
+                numbers[row] = append_digit(numbers[row], cells[row]);
+                present[row] |= cells[row] != ' ';
             }
-            else if (prob.operation == '+')
+        }
+
+        bool any = false;
+        long long result = operation == '*' ? 1 : 0;
+        for (size_t row = 0; row < numbers.size(); ++row)
+        {
+            if (present[row])
             {
-                result += prob.numbers[i];
+                any = true;
+                result = operation == '*' ? result * numbers[row] : result + numbers[row];
             }
         }
-
-        grand_total += result;
-    }
+        grand_total += any ? result : 0; });
 
     return grand_total;
 }
 
 /**
- * @brief Solve Advent of Code 2025 Day 6 Part 2.
- *
- * Reads worksheet problems with vertical digit reading and calculates results.
+ * @brief Solve Advent of Code 2025 Day 6 Part 1 from an input file.
  *
  * @param file_path Path to the input file
  * @return Grand total of all problem results
  * @throws std::runtime_error if the file cannot be read
  */
-[[nodiscard]] long long advent_of_code_2025_day6_part2(const std::filesystem::path &file_path)
+[[nodiscard]] long long advent_of_code_2025_day6_part1(const std::filesystem::path &file_path)
 {
-    const auto problems = read_input_vertical(file_path);
+    return advent_of_code_2025_day6_part1(read_input(file_path));
+}
 
+/**
+ * @brief Solve Advent of Code 2025 Day 6 Part 2.
+ *
+ * Reads worksheet problems vertically: each column is one number read top
+ * to bottom, straight from its contiguous cells. The problem's result is
+ * folded as the columns are read, so nothing is stored per problem.
+ *
+ * @param sheet Parsed worksheet
+ * @return Grand total of all problem results
+ * @throws std::runtime_error if the worksheet is malformed
+ */
+[[nodiscard]] long long advent_of_code_2025_day6_part2(const Worksheet &sheet)
+{
     long long grand_total = 0;
 
-    for (const auto &prob : problems)
-    {
-        long long result = prob.numbers[0];
-
-        for (int i = 1; i < prob.numbers.size(); ++i)
+    for_each_problem(sheet, [&](int col, int end_col, char operation)
+                     {
+        bool any = false;
+        long long result = operation == '*' ? 1 : 0;
+        for (int c = col; c < end_col; ++c)
         {
-            if (prob.operation == '*')
+            const std::string_view cells = sheet.column(c);
+            long long number = 0;
+            bool present = false;
+            for (const char cell : cells)
             {
-                result *= prob.numbers[i];
+                number = append_digit(number, cell);
+                present |= cell != ' ';
             }
-            else if (prob.operation == '+')
+            if (present)
             {
-                result += prob.numbers[i];
+                any = true;
+                result = operation == '*' ? result * number : result + number;
             }
         }
-
-        grand_total += result;
-    }
+        grand_total += any ? result : 0; });
 
     return grand_total;
 }
 
+/**
+ * @brief Solve Advent of Code 2025 Day 6 Part 2 from an input file.
+ *
+ * @param file_path Path to the input file
+ * @return Grand total of all problem results
+ * @throws std::runtime_error if the file cannot be read
+ */
+[[nodiscard]] long long advent_of_code_2025_day6_part2(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day6_part2(read_input(file_path));
+}
+
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 6 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day6_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day6_part2(input); });
+}
+
+} // namespace aoc2025::day6
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -345,6 +333,8 @@ struct Problem
  */
 int main()
 {
+    using namespace aoc2025::day6;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -352,21 +342,19 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1: Horizontal Reading ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day6_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Grand Total: " << result1_example << std::endl;
 
         std::cout << "=== Part 2: Vertical Reading ===" << std::endl;
         std::cout << "=== input_example.txt ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day6_part2(example_file);
         std::cout << "Grand Total: " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1: Horizontal Reading ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day6_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Grand Total: " << result1 << std::endl;
 
         std::cout << "=== Part 2: Vertical Reading ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day6_part2(input_file);
         std::cout << "Grand Total: " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -376,4 +364,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
@@ -1,115 +1,230 @@
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <vector>
-#include <set>
-#include <map>
-#include <queue>
-#include <functional>
+#include <string_view>
 #include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <stdexcept>
+#include <utility>
+
+#include "../../common/big_uint.hpp"
+#include "../../common/grid.hpp"
+#include "../../common/input.hpp"
+#include "../../common/stats.hpp"
+
+namespace aoc2025::day7
+{
 
 /**
- * @class BigInt
- * @brief Simple big integer class for addition only.
+ * @struct Manifold
+ * @brief Parsed manifold: splitter cells and the beam entry point.
  */
-class BigInt
+struct Manifold
 {
-private:
-    std::string digits;
+    aoc::BytePlane splitters; ///< 1 for every '^' cell
+    int startCol = -1;        ///< Column of the 'S' in the top row, -1 if missing
+};
 
+/**
+ * @brief Read grid from an input file.
+ *
+ * Maps a file containing a grid of characters.
+ * Each line represents one row of the grid.
+ *
+ * @param file_path Path to the input file
+ * @return Splitter plane and start column
+ * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ */
+[[nodiscard]] Manifold read_input(const std::filesystem::path &file_path)
+{
+    const aoc::InputLines lines(file_path);
+
+    Manifold manifold;
+    manifold.splitters = aoc::BytePlane::from_lines(lines, '^');
+    if (!lines.empty())
+    {
+        const auto start = lines[0].find('S');
+        manifold.startCol = start == std::string_view::npos ? -1 : static_cast<int>(start);
+    }
+    return manifold;
+}
+
+/**
+ * @class ManifoldSweep
+ * @brief Row-by-row simulation of tachyon beams moving down the manifold.
+ *
+ * Beams only ever move downwards, so the state after a row depends only on
+ * the row above. The sweep keeps two dense per-column arrays of timeline
+ * counts (current row and next row) instead of memoizing every cell, which
+ * needs O(cols) memory and lets rows be fed one at a time as they are read.
+ * A column holds beams iff its count is non-zero, so the same sweep yields
+ * both the number of splitters hit (Part 1) and the number of timelines
+ * (Part 2).
+ *
+ * The per-column arrays play the role of a memo: a beam arriving at a cell
+ * that already holds timelines is counted as a memo hit, the first beam to
+ * reach a cell as a miss.
+ */
+class ManifoldSweep
+{
 public:
-    BigInt(unsigned long long num = 0)
+    /**
+     * @brief Start a sweep with a single beam entering the top row.
+     *
+     * @param width Number of columns of the manifold
+     * @param start_col Column of the beam, or -1 for no beam
+     */
+    ManifoldSweep(int width, int start_col)
+        : current_(width), next_(width)
     {
-        if (num == 0)
-        {
-            digits = "0";
-        }
-        else
+        if (start_col >= 0 && start_col < width)
         {
-            while (num > 0)
-            {
-                digits = char('0' + num % 10) + digits;
-                num /= 10;
-            }
+            current_[start_col] = aoc::BigUint(1);
+            active_.push_back(start_col);
         }
     }
 
-    BigInt(const std::string &s) : digits(s) {}
-
-    BigInt operator+(const BigInt &other) const
+    /**
+     * @brief Move every beam through one row of the manifold.
+     *
+     * A beam on a splitter splits into the columns left and right of it on
+     * the next row; a split that leaves the manifold sideways ends its
+     * timeline. Only columns holding beams are looked at.
+     *
+     * @param splitters One flag per column of the next row, non-zero for '^'
+     */
+    void process_row(const std::uint8_t *splitters)
     {
-        std::string result;
-        int carry = 0;
-        int i = digits.length() - 1;
-        int j = other.digits.length() - 1;
+        const int width = static_cast<int>(current_.size());
+        std::vector<int> next_active;
+        next_active.reserve(active_.size() + 1);
+
+        const auto send = [&](int col, const aoc::BigUint &count)
+        {
+            if (col < 0 || col >= width)
+            {
+                finished_ += count;
+                return;
+            }
+            if (next_[col] == aoc::BigUint(0))
+            {
+                stats_.add(aoc::stats::Counter::MemoMisses);
+                next_active.push_back(col);
+            }
+            else
+            {
+                stats_.add(aoc::stats::Counter::MemoHits);
+            }
+            next_[col] += count;
+        };
 
-        while (i >= 0 || j >= 0 || carry)
+        stats_.add(aoc::stats::Counter::NodesExpanded, static_cast<long long>(active_.size()));
+        stats_.depth(++rows_);
+        for (const int col : active_)
         {
-            int sum = carry;
-            if (i >= 0)
-                sum += digits[i--] - '0';
-            if (j >= 0)
-                sum += other.digits[j--] - '0';
-
-            result = char('0' + sum % 10) + result;
-            carry = sum / 10;
+            if (splitters[col])
+            {
+                ++splits_;
+                send(col - 1, current_[col]);
+                send(col + 1, current_[col]);
+            }
+            else
+            {
+                send(col, current_[col]);
+            }
+            current_[col] = aoc::BigUint(0);
         }
 
-        return BigInt(result);
+        std::sort(next_active.begin(), next_active.end());
+        current_.swap(next_);
+        active_.swap(next_active);
     }
 
-    std::string toString() const
+    /**
+     * @brief Get the number of splitters reached so far.
+     * @return Distinct splitters hit by at least one beam
+     */
+    [[nodiscard]] int splits() const noexcept { return splits_; }
+
+    /**
+     * @brief Get the search counters of the sweep.
+     * @return Beams expanded, rows swept and cell merges; zero unless built with AOC_STATS
+     */
+    [[nodiscard]] const aoc::stats::Counters &stats() const noexcept { return stats_; }
+
+    /**
+     * @brief Get the number of timelines, counting beams still in flight.
+     * @return Timelines that left the grid plus beams below the last processed row
+     */
+    [[nodiscard]] aoc::BigUint timelines() const
     {
-        return digits;
+        aoc::BigUint total = finished_;
+        for (const int col : active_)
+        {
+            total += current_[col];
+        }
+        return total;
     }
-};
 
-/**
- * @struct Beam
- * @brief Represents a tachyon beam position in the grid.
- */
-struct Beam
-{
-    int row; /// Current row position
-    int col; /// Current column position
+private:
+    std::vector<aoc::BigUint> current_; ///< Timelines per column entering the next row
+    std::vector<aoc::BigUint> next_;    ///< Scratch row, all zero between calls
+    std::vector<int> active_;           ///< Columns of current_ with a non-zero count
+    aoc::BigUint finished_;             ///< Timelines that left the grid sideways
+    int splits_ = 0;                    ///< Splitters reached by a beam
+    int rows_ = 0;                      ///< Rows processed so far
+    aoc::stats::Counters stats_;        ///< Expansions, depth and cell merges
 };
 
 /**
- * @brief Read grid from an input file.
+ * @brief Sweep beams through every row of a text without indexing its lines.
  *
- * Reads a file containing a grid of characters.
- * Each line represents one row of the grid.
+ * Memory use is O(cols) regardless of the number of rows, so very tall
+ * manifolds can be processed straight from the mapped file. The width is
+ * taken from the top row; columns past the end of a short row are empty.
  *
- * @param file_path Path to the input file
- * @return Vector of strings representing the grid
- * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ * @param text Whole grid, one row per line
+ * @return Finished sweep
  */
-[[nodiscard]] std::vector<std::string> read_input(const std::filesystem::path &file_path)
+[[nodiscard]] ManifoldSweep sweep_manifold(std::string_view text)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
+    auto rows = aoc::lines(text);
+    auto it = rows.begin();
+    const std::string_view top = it == rows.end() ? std::string_view{} : *it;
+    const auto start = top.find('S');
+
+    ManifoldSweep sweep(static_cast<int>(top.size()), start == std::string_view::npos ? -1 : static_cast<int>(start));
+    std::vector<std::uint8_t> splitters(top.size());
+    for (; it != rows.end(); ++it)
     {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
+        const std::string_view row = *it;
+        for (size_t col = 0; col < splitters.size(); col++)
+        {
+            splitters[col] = col < row.size() && row[col] == '^';
+        }
+        sweep.process_row(splitters.data());
     }
+    aoc::stats::record("sweep", 1, sweep.stats());
+    return sweep;
+}
 
-    std::vector<std::string> grid;
-    grid.reserve(50);
-
-    std::string line;
-    while (std::getline(file, line))
+/**
+ * @brief Sweep beams through every row of a parsed manifold.
+ *
+ * @param manifold The manifold to simulate
+ * @return Finished sweep
+ */
+[[nodiscard]] ManifoldSweep sweep_manifold(const Manifold &manifold)
+{
+    const aoc::BytePlane &splitters = manifold.splitters;
+    ManifoldSweep sweep(splitters.cols(), manifold.startCol);
+    for (int row = 0; row < splitters.rows(); row++)
     {
-        grid.push_back(std::move(line));
+        sweep.process_row(splitters.row(row));
     }
-
-    grid.shrink_to_fit();
-    return grid;
+    aoc::stats::record("sweep", 1, sweep.stats());
+    return sweep;
 }
 
 /**
@@ -121,133 +236,23 @@ struct Beam
  * @param grid The grid to simulate
  * @return Number of beam splits
  */
-[[nodiscard]] int simulate_tachyon_beam(const std::vector<std::string> &grid)
+[[nodiscard]] int simulate_tachyon_beam(const Manifold &grid)
 {
-
-    if (grid.empty())
-        return 0;
-
-    // Find the starting position (S)
-    const auto it = std::find(grid[0].begin(), grid[0].end(), 'S');
-    if (it == grid[0].end())
-        return 0;
-
-    const int start_col = static_cast<int>(std::distance(grid[0].begin(), it));
-
-    int split_count = 0;
-    std::queue<Beam> beams;
-    beams.push({0, start_col});
-
-    // Track which beams we've already processed to avoid infinite loops
-    std::set<std::pair<int, int>> processed;
-
-    while (!beams.empty())
-    {
-        Beam current = beams.front();
-        beams.pop();
-
-        // Move the beam downward until it hits a splitter or exits the grid
-        while (current.row < grid.size())
-        {
-            // Check if we've already processed a beam at this position
-            auto key = std::make_pair(current.row, current.col);
-            if (processed.count(key) > 0)
-            {
-                break;
-            }
-            processed.insert(key);
-
-            // Check what's at the current position
-            if (current.row < grid.size() && current.col >= 0 && current.col < grid[current.row].length())
-            {
-                if (grid[current.row][current.col] == '^')
-                {
-                    // Hit a splitter - create two new beams
-                    split_count++;
-
-                    // Left beam
-                    if (current.col - 1 >= 0)
-                    {
-                        beams.push({current.row + 1, current.col - 1});
-                    }
-
-                    // Right beam
-                    if (current.col + 1 < grid[current.row].length())
-                    {
-                        beams.push({current.row + 1, current.col + 1});
-                    }
-
-                    break; // Stop this beam
-                }
-            }
-
-            // Move down
-            current.row++;
-        }
-    }
-
-    return split_count;
+    return sweep_manifold(grid).splits();
 }
 
 /**
  * @brief Count quantum timelines through the grid.
  *
- * Uses memoization to count all possible paths through the grid.
- * Each beam split creates a new timeline.
+ * Each beam split creates a new timeline; timelines reaching the same cell
+ * are merged into one count per column.
  *
  * @param grid The grid to analyze
  * @return Number of quantum timelines
  */
-[[nodiscard]] BigInt count_quantum_timelines(const std::vector<std::string> &grid)
+[[nodiscard]] aoc::BigUint count_quantum_timelines(const Manifold &grid)
 {
-    if (grid.empty())
-        return BigInt(0);
-
-    // Find the starting position (S)
-    const auto it = std::find(grid[0].begin(), grid[0].end(), 'S');
-    if (it == grid[0].end())
-        return BigInt(0);
-
-    const int start_col = static_cast<int>(std::distance(grid[0].begin(), it));
-
-    // Memoization cache: position -> number of timelines from that position
-    std::map<std::pair<int, int>, BigInt> memo;
-
-    std::function<BigInt(int, int)> dfs;
-    dfs = [&](int row, int col) -> BigInt
-    {
-        // Check if we exited the grid - this completes one timeline
-        if (row >= grid.size() || col < 0 || col >= grid[0].length())
-        {
-            return BigInt(1);
-        }
-
-        // Check memoization cache
-        auto pos = std::make_pair(row, col);
-        if (memo.find(pos) != memo.end())
-        {
-            return memo[pos];
-        }
-
-        BigInt count(0);
-
-        // Check if we hit a splitter
-        if (grid[row][col] == '^')
-        {
-            // Split into two paths (left and right)
-            count = dfs(row + 1, col - 1) + dfs(row + 1, col + 1);
-        }
-        else
-        {
-            // Continue moving down
-            count = dfs(row + 1, col);
-        }
-
-        memo[pos] = count;
-        return count;
-    };
-
-    return dfs(0, start_col);
+    return sweep_manifold(grid).timelines();
 }
 
 /**
@@ -255,14 +260,27 @@ struct Beam
  *
  * Simulates tachyon beam through the grid and counts beam splits.
  *
+ * @param grid Parsed manifold
+ * @return Number of beam splits
+ */
+[[nodiscard]] int advent_of_code_2025_day7_part1(const Manifold &grid)
+{
+    return simulate_tachyon_beam(grid);
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 7 Part 1 from an input file.
+ *
+ * Streams the rows straight from the mapped file.
+ *
  * @param file_path Path to the input file
  * @return Number of beam splits
  * @throws std::runtime_error if the file cannot be read
  */
 [[nodiscard]] int advent_of_code_2025_day7_part1(const std::filesystem::path &file_path)
 {
-    const auto grid = read_input(file_path);
-    return simulate_tachyon_beam(grid);
+    const aoc::MappedFile file(file_path);
+    return sweep_manifold(file.view()).splits();
 }
 
 /**
@@ -270,16 +288,49 @@ struct Beam
  *
  * Counts all possible quantum timelines through the grid.
  *
+ * @param grid Parsed manifold
+ * @return Number of quantum timelines
+ */
+[[nodiscard]] aoc::BigUint advent_of_code_2025_day7_part2(const Manifold &grid)
+{
+    return count_quantum_timelines(grid);
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 7 Part 2 from an input file.
+ *
+ * Streams the rows straight from the mapped file.
+ *
  * @param file_path Path to the input file
- * @return Number of quantum timelines as BigInt
+ * @return Number of quantum timelines
  * @throws std::runtime_error if the file cannot be read
  */
-[[nodiscard]] BigInt advent_of_code_2025_day7_part2(const std::filesystem::path &file_path)
+[[nodiscard]] aoc::BigUint advent_of_code_2025_day7_part2(const std::filesystem::path &file_path)
 {
-    const auto grid = read_input(file_path);
-    return count_quantum_timelines(grid);
+    const aoc::MappedFile file(file_path);
+    return sweep_manifold(file.view()).timelines();
+}
+
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 7 from an input file.
+ *
+ * One sweep yields both the split count and the timeline count, so the
+ * file is streamed once.
+ *
+ * @param file_path Path to the grid input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read
+ */
+[[nodiscard]] std::pair<int, aoc::BigUint> solve_both_parts(const std::filesystem::path &file_path)
+{
+    const aoc::MappedFile file(file_path);
+    const ManifoldSweep sweep = sweep_manifold(file.view());
+    return {sweep.splits(), sweep.timelines()};
 }
 
+} // namespace aoc2025::day7
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -290,6 +341,8 @@ struct Beam
  */
 int main()
 {
+    using namespace aoc2025::day7;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -297,21 +350,19 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day7_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Total beam splits: " << result1_example << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day7_part2(example_file);
-        std::cout << "Total quantum timelines: " << result2_example.toString() << std::endl;
+        std::cout << "Total quantum timelines: " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day7_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Total beam splits: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day7_part2(input_file);
-        std::cout << "Total quantum timelines: " << result2.toString() << std::endl;
+        std::cout << "Total quantum timelines: " << result2 << std::endl;
     }
     catch (const std::exception &e)
     {
@@ -320,4 +371,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
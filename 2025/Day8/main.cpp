@@ -1,14 +1,26 @@
 #include <iostream>
-#include <fstream>
 #include <vector>
 #include <string>
-#include <cmath>
+#include <limits>
+#include <compare>
 #include <algorithm>
-#include <sstream>
-#include <map>
+#include <array>
+#include <cstddef>
 #include <filesystem>
 #include <stdexcept>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "../../common/input.hpp"
+#include "../../common/parse_cache.hpp"
+#include "../../common/solve.hpp"
+#include "../../common/union_find.hpp"
+
+namespace aoc2025::day8
+{
+
 /**
  * @struct Point3D
  * @brief Represents a 3D point with integer coordinates.
@@ -20,101 +32,440 @@ struct Point3D
     int z; /// Z coordinate
 };
 
-// Union-Find (Disjoint Set Union) data structure
-class UnionFind
+/// Squared Euclidean distance; exact while every axis spans less than kMaxSpan
+using Distance = long long;
+
+/// Largest coordinate range per axis: 3 * kMaxSpan^2 still fits a Distance, and a difference fits an int
+inline constexpr long long kMaxSpan = 1'700'000'000;
+
+/**
+ * @brief Calculate squared Euclidean distance between two 3D points.
+ *
+ * Ordering by squared distance is the same as ordering by distance, and it
+ * avoids floating point entirely. Coordinates are widened before they are
+ * subtracted; the result is exact as long as the points span less than
+ * kMaxSpan on every axis, which parse_input() checks.
+ *
+ * @param a First point
+ * @param b Second point
+ * @return Squared distance between points
+ */
+[[nodiscard]] Distance squared_distance(const Point3D &a, const Point3D &b) noexcept
 {
-private:
-    std::vector<int> parent;
-    std::vector<int> rank;
-    std::vector<int> size;
+    const Distance dx = Distance{a.x} - b.x;
+    const Distance dy = Distance{a.y} - b.y;
+    const Distance dz = Distance{a.z} - b.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+/**
+ * @brief Squared distances from one point to a block of points in coordinate arrays.
+ *
+ * Coordinate differences are taken in 32 bits, which is exact because the
+ * points span less than kMaxSpan on every axis, and squared into 64-bit
+ * lanes, 4 points per step with AVX2. The rest of the block is done by the
+ * scalar loop.
+ *
+ * @param query Point to measure from
+ * @param xs X coordinates of the block
+ * @param ys Y coordinates of the block
+ * @param zs Z coordinates of the block
+ * @param count Number of points in the block
+ * @param out Receives one squared distance per point
+ */
+inline void squared_distances(const Point3D &query, const int *xs, const int *ys, const int *zs, int count,
+                              Distance *out) noexcept
+{
+    int k = 0;
+#if defined(__AVX2__)
+    const __m128i qx4 = _mm_set1_epi32(query.x);
+    const __m128i qy4 = _mm_set1_epi32(query.y);
+    const __m128i qz4 = _mm_set1_epi32(query.z);
+    const auto square4 = [](const int *p, __m128i q)
+    {
+        const __m256i d = _mm256_cvtepi32_epi64(_mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), q));
+        return _mm256_mul_epi32(d, d);
+    };
+    for (; k + 4 <= count; k += 4)
+    {
+        const __m256i sum = _mm256_add_epi64(_mm256_add_epi64(square4(xs + k, qx4), square4(ys + k, qy4)),
+                                             square4(zs + k, qz4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + k), sum);
+    }
+#endif
+    for (; k < count; ++k)
+    {
+        out[k] = squared_distance(query, Point3D{xs[k], ys[k], zs[k]});
+    }
+}
+
+/**
+ * @struct Edge
+ * @brief Connection between two junctions, ordered by distance.
+ *
+ * Ties are broken by endpoint indices so that all edges are totally ordered
+ * and the minimum spanning tree is unique.
+ */
+struct Edge
+{
+    Distance dist; /// Squared length of the connection
+    int i;         /// Smaller junction index
+    int j;         /// Larger junction index
+
+    friend auto operator<=>(const Edge &, const Edge &) = default;
+};
+
+/**
+ * @brief Build an edge with its endpoints in canonical order.
+ *
+ * @param a First junction index
+ * @param b Second junction index
+ * @param dist Squared distance between the junctions
+ * @return Edge with i < j
+ */
+[[nodiscard]] Edge make_edge(int a, int b, Distance dist) noexcept
+{
+    return a < b ? Edge{dist, a, b} : Edge{dist, b, a};
+}
 
+/**
+ * @class KdTree
+ * @brief Static 3D k-d tree over junction positions.
+ *
+ * Nodes are stored in preorder with their bounding boxes, so a search can
+ * discard a whole subtree once its box is farther away than the current
+ * bound. Leaves hold a handful of points in a contiguous range, and the
+ * coordinates are kept as separate x/y/z arrays in tree order so a leaf is
+ * measured with one call to squared_distances().
+ */
+class KdTree
+{
 public:
-    UnionFind(int n)
+    /**
+     * @brief Build the tree, splitting each node at the median of its widest axis.
+     *
+     * @param points Junction positions; indices into this vector are reported by searches
+     */
+    explicit KdTree(const std::vector<Point3D> &points)
+        : points_(points), index_(points.size())
     {
-        parent.resize(n);
-        rank.resize(n, 0);
-        size.resize(n, 1);
-        for (int i = 0; i < n; i++)
+        for (int i = 0; i < static_cast<int>(index_.size()); ++i)
         {
-            parent[i] = i;
+            index_[i] = i;
+        }
+        nodes_.reserve(2 * points.size() / kLeafSize + 1);
+        if (!points_.empty())
+        {
+            build(0, static_cast<int>(points_.size()));
         }
-    }
 
-    int find(int x)
-    {
-        if (parent[x] != x)
+        for (auto &axis : coords_)
+        {
+            axis.reserve(points_.size());
+        }
+        for (const int i : index_)
         {
-            parent[x] = find(parent[x]); // Path compression
+            coords_[0].push_back(points_[i].x);
+            coords_[1].push_back(points_[i].y);
+            coords_[2].push_back(points_[i].z);
         }
-        return parent[x];
     }
 
-    bool unite(int x, int y)
+    /**
+     * @brief Number of nodes in the tree.
+     * @return Node count, used to size per-node label arrays
+     */
+    [[nodiscard]] std::size_t node_count() const noexcept { return nodes_.size(); }
+
+    /**
+     * @brief Label every node with the common label of its points.
+     *
+     * @param point_labels Label per original point index
+     * @return Label per node, or -1 for nodes whose points have mixed labels
+     */
+    [[nodiscard]] std::vector<int> node_labels(const std::vector<int> &point_labels) const
     {
-        int rootX = find(x);
-        int rootY = find(y);
-
-        if (rootX == rootY)
+        std::vector<int> labels(nodes_.size());
+        // Children always come after their parent, so a reverse sweep is bottom-up
+        for (int n = static_cast<int>(nodes_.size()) - 1; n >= 0; --n)
         {
-            return false; // Already in same set
+            const Node &node = nodes_[n];
+            if (node.left < 0)
+            {
+                int label = point_labels[index_[node.begin]];
+                for (int k = node.begin + 1; k < node.end && label >= 0; ++k)
+                {
+                    if (point_labels[index_[k]] != label)
+                    {
+                        label = -1;
+                    }
+                }
+                labels[n] = label;
+            }
+            else
+            {
+                labels[n] = labels[node.left] == labels[node.right] ? labels[node.left] : -1;
+            }
         }
+        return labels;
+    }
 
-        // Union by rank
-        if (rank[rootX] < rank[rootY])
-        {
-            parent[rootX] = rootY;
-            size[rootY] += size[rootX];
-        }
-        else if (rank[rootX] > rank[rootY])
+    /**
+     * @brief Visit every point that may lie within a shrinking distance bound.
+     *
+     * Subtrees whose bounding box is farther than bound() or for which
+     * skip(node) holds are never entered; the nearer child is searched first
+     * so that the bound tightens quickly.
+     *
+     * @param query Position to search around
+     * @param bound Callable returning the current inclusive squared-distance limit
+     * @param skip Callable taking a node index, true to prune that subtree
+     * @param visit Callable taking (point index, squared distance)
+     */
+    template <typename Bound, typename Skip, typename Visit>
+    void search(const Point3D &query, Bound &&bound, Skip &&skip, Visit &&visit) const
+    {
+        if (nodes_.empty())
         {
-            parent[rootY] = rootX;
-            size[rootX] += size[rootY];
+            return;
         }
-        else
+
+        std::array<Distance, kLeafSize> dists;
+        std::vector<int> &stack = stack_;
+        stack.clear();
+        stack.push_back(0);
+        while (!stack.empty())
         {
-            parent[rootY] = rootX;
-            size[rootX] += size[rootY];
-            rank[rootX]++;
+            const int n = stack.back();
+            stack.pop_back();
+            const Node &node = nodes_[n];
+            if (skip(n) || box_distance(node, query) > bound())
+            {
+                continue;
+            }
+
+            if (node.left < 0)
+            {
+                squared_distances(query, coords_[0].data() + node.begin, coords_[1].data() + node.begin,
+                                  coords_[2].data() + node.begin, node.end - node.begin, dists.data());
+                for (int k = node.begin; k < node.end; ++k)
+                {
+                    const Distance dist = dists[k - node.begin];
+                    if (dist <= bound())
+                    {
+                        visit(index_[k], dist);
+                    }
+                }
+                continue;
+            }
+
+            const bool go_left = coordinate(query, node.axis) < coords_[node.axis][node.split];
+            stack.push_back(go_left ? node.right : node.left);
+            stack.push_back(go_left ? node.left : node.right);
         }
-        return true;
     }
 
-    int getSize(int x)
+private:
+    static constexpr int kLeafSize = 8;
+
+    struct Node
+    {
+        Point3D lo;     /// Bounding box minimum
+        Point3D hi;     /// Bounding box maximum
+        int begin;      /// First point in index_
+        int end;        /// One past the last point in index_
+        int left = -1;  /// Left child, -1 for leaves
+        int right = -1; /// Right child, -1 for leaves
+        int axis = 0;   /// Split axis for inner nodes
+        int split = 0;  /// Position of the median point in coords_
+    };
+
+    [[nodiscard]] static int coordinate(const Point3D &p, int axis) noexcept
+    {
+        return axis == 0 ? p.x : (axis == 1 ? p.y : p.z);
+    }
+
+    [[nodiscard]] static Distance box_distance(const Node &node, const Point3D &q) noexcept
     {
-        return size[find(x)];
+        Distance total = 0;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const Distance v = coordinate(q, axis);
+            const Distance lo = coordinate(node.lo, axis);
+            const Distance hi = coordinate(node.hi, axis);
+            const Distance gap = v < lo ? lo - v : (v > hi ? v - hi : 0);
+            total += gap * gap;
+        }
+        return total;
     }
 
-    std::vector<int> getAllSizes()
+    int build(int begin, int end)
     {
-        std::map<int, int> componentSizes;
-        for (int i = 0; i < parent.size(); i++)
+        Node node{points_[index_[begin]], points_[index_[begin]], begin, end};
+        for (int k = begin + 1; k < end; ++k)
         {
-            int root = find(i);
-            componentSizes[root] = size[root];
+            const Point3D &p = points_[index_[k]];
+            node.lo = {std::min(node.lo.x, p.x), std::min(node.lo.y, p.y), std::min(node.lo.z, p.z)};
+            node.hi = {std::max(node.hi.x, p.x), std::max(node.hi.y, p.y), std::max(node.hi.z, p.z)};
         }
 
-        std::vector<int> sizes;
-        for (const auto &p : componentSizes)
+        const int id = static_cast<int>(nodes_.size());
+        nodes_.push_back(node);
+
+        if (end - begin <= kLeafSize)
         {
-            sizes.push_back(p.second);
+            return id;
         }
-        return sizes;
+
+        const int extents[3] = {node.hi.x - node.lo.x, node.hi.y - node.lo.y, node.hi.z - node.lo.z};
+        const int axis = static_cast<int>(std::max_element(extents, extents + 3) - extents);
+        const int mid = begin + (end - begin) / 2;
+        std::nth_element(index_.begin() + begin, index_.begin() + mid, index_.begin() + end,
+                         [&](int a, int b)
+                         { return coordinate(points_[a], axis) < coordinate(points_[b], axis); });
+
+        const int left = build(begin, mid);
+        const int right = build(mid, end);
+        nodes_[id].left = left;
+        nodes_[id].right = right;
+        nodes_[id].axis = axis;
+        nodes_[id].split = mid;
+        return id;
     }
+
+    const std::vector<Point3D> &points_; ///< Positions in input order
+    std::vector<int> index_;             ///< Point indices in tree order
+    std::array<std::vector<int>, 3> coords_; ///< X, Y and Z coordinates in tree order, for vectorized leaves
+    std::vector<Node> nodes_;            ///< Nodes in preorder, root first
+    mutable std::vector<int> stack_;     ///< Reused traversal stack
 };
 
 /**
- * @brief Calculate Euclidean distance between two 3D points.
+ * @brief Find the k shortest connections between junctions.
  *
- * @param a First point
- * @param b Second point
- * @return Distance between points
+ * Every point queries the tree for partners with a larger index that beat
+ * the current k-th best edge. Candidates are appended to a buffer of 2k;
+ * whenever it fills up, nth_element keeps the k best and tightens the bound,
+ * so each candidate costs amortized O(1) instead of a heap update and
+ * memory stays at O(n + k) instead of all n(n-1)/2 pairs.
+ *
+ * @param junctions Junction box positions
+ * @param tree Spatial index over the same positions
+ * @param k Number of edges wanted
+ * @return Up to k shortest edges in increasing order
  */
-[[nodiscard]] double distance(const Point3D &a, const Point3D &b) noexcept
+[[nodiscard]] std::vector<Edge> k_shortest_edges(const std::vector<Point3D> &junctions, const KdTree &tree, std::size_t k)
 {
-    long long dx = a.x - b.x;
-    long long dy = a.y - b.y;
-    long long dz = a.z - b.z;
-    return std::sqrt(dx * dx + dy * dy + dz * dz);
+    std::vector<Edge> best;
+    if (k == 0)
+    {
+        return best;
+    }
+    best.reserve(2 * k);
+
+    // k-th best edge as of the last selection; nothing that fails to beat it can make the cut
+    Edge worst{std::numeric_limits<Distance>::max(), std::numeric_limits<int>::max(), std::numeric_limits<int>::max()};
+    const auto keep_best = [&]
+    {
+        std::nth_element(best.begin(), best.begin() + (k - 1), best.end());
+        best.resize(k);
+        worst = best.back();
+    };
+    const auto bound = [&]
+    { return worst.dist; };
+
+    for (int i = 0; i < static_cast<int>(junctions.size()); ++i)
+    {
+        tree.search(
+            junctions[i], bound, [](int)
+            { return false; },
+            [&](int j, Distance dist)
+            {
+                if (j <= i)
+                {
+                    return;
+                }
+                const Edge edge{dist, i, j};
+                if (!(edge < worst))
+                {
+                    return;
+                }
+                best.push_back(edge);
+                if (best.size() == 2 * k)
+                {
+                    keep_best();
+                }
+            });
+    }
+
+    if (best.size() > k)
+    {
+        keep_best();
+    }
+    std::sort(best.begin(), best.end());
+    return best;
+}
+
+/**
+ * @brief Compute the Euclidean minimum spanning tree of the junctions.
+ *
+ * Uses Boruvka's algorithm: every round each circuit finds its shortest
+ * connection to another circuit through the k-d tree, skipping subtrees that
+ * lie entirely inside the circuit, and all those connections are merged.
+ * The number of circuits at least halves each round.
+ *
+ * @param junctions Junction box positions
+ * @param tree Spatial index over the same positions
+ * @return The n-1 spanning tree edges in increasing order
+ */
+[[nodiscard]] std::vector<Edge> euclidean_mst(const std::vector<Point3D> &junctions, const KdTree &tree)
+{
+    const int n = static_cast<int>(junctions.size());
+    const Edge none{std::numeric_limits<Distance>::max(), -1, -1};
+
+    aoc::UnionFind uf(n);
+    std::vector<Edge> mst;
+    mst.reserve(n > 0 ? n - 1 : 0);
+
+    std::vector<int> component(n);
+    std::vector<Edge> best(n);
+    while (uf.components() > 1)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            component[i] = uf.find(i);
+        }
+        const std::vector<int> labels = tree.node_labels(component);
+        std::fill(best.begin(), best.end(), none);
+
+        for (int i = 0; i < n; ++i)
+        {
+            const int c = component[i];
+            tree.search(
+                junctions[i], [&]
+                { return best[c].dist; },
+                [&](int node)
+                { return labels[node] == c; },
+                [&](int j, Distance dist)
+                {
+                    if (component[j] != c)
+                    {
+                        best[c] = std::min(best[c], make_edge(i, j, dist));
+                    }
+                });
+        }
+
+        for (int c = 0; c < n; ++c)
+        {
+            if (best[c].i >= 0 && uf.unite(best[c].i, best[c].j))
+            {
+                mst.push_back(best[c]);
+            }
+        }
+    }
+
+    std::sort(mst.begin(), mst.end());
+    return mst;
 }
 
 /**
@@ -124,98 +475,119 @@ public:
  *
  * @param file_path Path to the input file
  * @return Vector of Point3D structures
- * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ * @throws std::runtime_error if the file doesn't exist or cannot be opened, or
+ *         if the points span kMaxSpan or more on some axis
  */
-[[nodiscard]] std::vector<Point3D> read_input(const std::filesystem::path &file_path)
+[[nodiscard]] std::vector<Point3D> parse_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
+    const aoc::MappedFile file(file_path);
 
     std::vector<Point3D> junctions;
     junctions.reserve(100);
 
-    std::string line;
-    while (std::getline(file, line))
+    size_t line_number = 0;
+    for (auto line : aoc::lines(file.view()))
     {
-        std::stringstream ss(line);
+        ++line_number;
+        if (aoc::trim(line).empty())
+        {
+            continue;
+        }
+
         Point3D p;
-        char comma;
-        ss >> p.x >> comma >> p.y >> comma >> p.z;
+        if (!aoc::consume_int(line, p.x) || !aoc::consume_char(line, ',') ||
+            !aoc::consume_int(line, p.y) || !aoc::consume_char(line, ',') ||
+            !aoc::consume_int(line, p.z))
+        {
+            throw std::runtime_error("Invalid junction format at line " + std::to_string(line_number));
+        }
         junctions.push_back(p);
     }
 
+    if (!junctions.empty())
+    {
+        const auto span = [&](auto axis)
+        {
+            const auto [lo, hi] = std::minmax_element(junctions.begin(), junctions.end(),
+                                                      [&](const Point3D &a, const Point3D &b)
+                                                      { return a.*axis < b.*axis; });
+            return static_cast<long long>((*hi).*axis) - (*lo).*axis;
+        };
+        if (span(&Point3D::x) >= kMaxSpan || span(&Point3D::y) >= kMaxSpan || span(&Point3D::z) >= kMaxSpan)
+        {
+            throw std::runtime_error("Junction coordinates span too far for exact squared distances");
+        }
+    }
+
     junctions.shrink_to_fit();
     return junctions;
 }
 
+/// Layout of the junction list in the parse cache; bump when save() changes
+inline constexpr std::uint32_t kCacheSchema = 20250801;
+
+/**
+ * @brief Serialize junction points for the parse cache.
+ * @param writer Destination
+ * @param junctions Parsed points
+ */
+void save(aoc::BinaryWriter &writer, const std::vector<Point3D> &junctions)
+{
+    writer.write_vector(junctions);
+}
+
+/**
+ * @brief Deserialize junction points written by save().
+ *
+ * @param reader Source
+ * @param junctions Receives the points
+ * @throws std::runtime_error if the data is truncated
+ */
+void load(aoc::BinaryReader &reader, std::vector<Point3D> &junctions)
+{
+    junctions = reader.read_vector<Point3D>();
+}
+
+/**
+ * @brief Read 3D junction points from input file, through the parse cache when it is enabled.
+ *
+ * @param file_path Path to the input file
+ * @return Vector of Point3D structures
+ * @throws std::runtime_error if the file doesn't exist or cannot be opened
+ */
+[[nodiscard]] std::vector<Point3D> read_input(const std::filesystem::path &file_path)
+{
+    return aoc::parse_cache::load_or_parse<std::vector<Point3D>>(file_path, kCacheSchema, parse_input);
+}
+
 /**
  * @brief Solve Advent of Code 2025 Day 8 Part 1.
  *
  * Connects junction boxes with limited connections and calculates
  * the product of the three largest circuits.
  *
- * @param file_path Path to the input file
+ * @param junctions Junction box positions
  * @return Product of three largest circuit sizes
- * @throws std::runtime_error if the file cannot be read
  */
-[[nodiscard]] long long advent_of_code_2025_day8_part1(const std::filesystem::path &file_path)
+[[nodiscard]] long long advent_of_code_2025_day8_part1(const std::vector<Point3D> &junctions)
 {
-    const auto junctions = read_input(file_path);
     const int n = static_cast<int>(junctions.size());
 
-    // Create list of all pairs with their distances
-    struct Edge
-    {
-        int i, j;
-        double dist;
-        bool operator<(const Edge &other) const
-        {
-            return dist < other.dist;
-        }
-    };
-
-    std::vector<Edge> edges;
-    for (int i = 0; i < n; i++)
-    {
-        for (int j = i + 1; j < n; j++)
-        {
-            double d = distance(junctions[i], junctions[j]);
-            edges.push_back({i, j, d});
-        }
-    }
-
-    // Sort edges by distance
-    std::sort(edges.begin(), edges.end());
+    // Connect the closest pairs (10 for example, 1000 for full input)
+    const std::size_t connections = (n == 20) ? 10 : 1000; // 20 boxes = example, otherwise full input
+    const KdTree tree(junctions);
+    const std::vector<Edge> edges = k_shortest_edges(junctions, tree, connections);
 
     // Union-Find to track circuits
-    UnionFind uf(n);
-
-    // Connect the closest pairs (10 for example, n-1 for full input to ensure connectivity)
-    int connections = (n == 20) ? 10 : 1000; // 20 boxes = example, otherwise full input
-    int attempts = 0;
+    aoc::UnionFind uf(n);
 
     for (const auto &edge : edges)
     {
-        if (attempts >= connections)
-            break;
-
-        attempts++;
         uf.unite(edge.i, edge.j);
     }
 
-    // Get all circuit sizes
-    std::vector<int> sizes = uf.getAllSizes();
-    std::sort(sizes.rbegin(), sizes.rend()); // Sort descending
-
     // Multiply the three largest
+    const std::vector<int> sizes = uf.largest_sizes(3);
     if (sizes.size() >= 3)
     {
         return static_cast<long long>(sizes[0]) * sizes[1] * sizes[2];
@@ -223,69 +595,78 @@ public:
     return 0;
 }
 
+/**
+ * @brief Solve Advent of Code 2025 Day 8 Part 1 from an input file.
+ *
+ * @param file_path Path to the input file
+ * @return Product of three largest circuit sizes
+ * @throws std::runtime_error if the file cannot be read
+ */
+[[nodiscard]] long long advent_of_code_2025_day8_part1(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day8_part1(read_input(file_path));
+}
+
 /**
  * @brief Solve Advent of Code 2025 Day 8 Part 2.
  *
  * Connects all junction boxes into one circuit and calculates
  * the product of X coordinates of the last connection.
  *
- * @param file_path Path to the input file
+ * @param junctions Junction box positions
  * @return Product of X coordinates of last connection
- * @throws std::runtime_error if the file cannot be read
  */
-[[nodiscard]] long long advent_of_code_2025_day8_part2(const std::filesystem::path &file_path)
+[[nodiscard]] long long advent_of_code_2025_day8_part2(const std::vector<Point3D> &junctions)
 {
-    const auto junctions = read_input(file_path);
     const int n = static_cast<int>(junctions.size());
 
-    // Create list of all pairs with their distances
-    struct Edge
-    {
-        int i, j;
-        double dist;
-        bool operator<(const Edge &other) const
-        {
-            return dist < other.dist;
-        }
-    };
-
-    std::vector<Edge> edges;
-    for (int i = 0; i < n; i++)
+    if (n < 2)
     {
-        for (int j = i + 1; j < n; j++)
-        {
-            double d = distance(junctions[i], junctions[j]);
-            edges.push_back({i, j, d});
-        }
+        return 0;
     }
 
-    // Sort edges by distance
-    std::sort(edges.begin(), edges.end());
-
-    // Union-Find to track circuits
-    UnionFind uf(n);
+    // The connection that finally joins everything is the longest edge of
+    // the minimum spanning tree
+    const KdTree tree(junctions);
+    const Edge last = euclidean_mst(junctions, tree).back();
 
-    // Connect pairs until all are in one circuit
-    int lastI = -1, lastJ = -1;
-
-    for (const auto &edge : edges)
-    {
-        if (uf.unite(edge.i, edge.j))
-        {
-            lastI = edge.i;
-            lastJ = edge.j;
+    return static_cast<long long>(junctions[last.i].x) * junctions[last.j].x;
+}
 
-            // Check if all are in one circuit
-            if (uf.getSize(0) == n)
-            {
-                break;
-            }
-        }
-    }
+/**
+ * @brief Solve Advent of Code 2025 Day 8 Part 2 from an input file.
+ *
+ * @param file_path Path to the input file
+ * @return Product of X coordinates of last connection
+ * @throws std::runtime_error if the file cannot be read
+ */
+[[nodiscard]] long long advent_of_code_2025_day8_part2(const std::filesystem::path &file_path)
+{
+    return advent_of_code_2025_day8_part2(read_input(file_path));
+}
 
-    return static_cast<long long>(junctions[lastI].x) * junctions[lastJ].x;
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 8 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day8_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day8_part2(input); });
 }
 
+} // namespace aoc2025::day8
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
@@ -296,6 +677,8 @@ public:
  */
 int main()
 {
+    using namespace aoc2025::day8;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -303,20 +686,18 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day8_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Product of three largest circuits: " << result1_example << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day8_part2(example_file);
         std::cout << "Product of X coordinates: " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day8_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Product of three largest circuits: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day8_part2(input_file);
         std::cout << "Product of X coordinates: " << result2 << std::endl;
     }
     catch (const std::exception &e)
@@ -326,4 +707,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
@@ -1,14 +1,18 @@
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <vector>
 #include <string>
 #include <algorithm>
-#include <set>
-#include <map>
+#include <cstdlib>
+#include <utility>
 #include <filesystem>
 #include <stdexcept>
 
+#include "../../common/input.hpp"
+#include "../../common/solve.hpp"
+
+namespace aoc2025::day9
+{
+
 /**
  * @struct Point
  * @brief Represents a 2D point with integer coordinates.
@@ -42,27 +46,25 @@ struct Point
  */
 [[nodiscard]] std::vector<Point> read_input(const std::filesystem::path &file_path)
 {
-    if (!std::filesystem::exists(file_path))
-    {
-        throw std::runtime_error("File does not exist: " + file_path.string());
-    }
-
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("Cannot open file: " + file_path.string());
-    }
+    const aoc::MappedFile file(file_path);
 
     std::vector<Point> redTiles;
     redTiles.reserve(100);
 
-    std::string line;
-    while (std::getline(file, line))
+    size_t lineNumber = 0;
+    for (auto line : aoc::lines(file.view()))
     {
+        ++lineNumber;
+        if (aoc::trim(line).empty())
+        {
+            continue;
+        }
+
         int x, y;
-        char comma;
-        std::stringstream ss(line);
-        ss >> x >> comma >> y;
+        if (!aoc::consume_int(line, x) || !aoc::consume_char(line, ',') || !aoc::consume_int(line, y))
+        {
+            throw std::runtime_error("Invalid tile format at line " + std::to_string(lineNumber));
+        }
         redTiles.push_back({x, y});
     }
 
@@ -71,37 +73,206 @@ struct Point
 }
 
 /**
- * @brief Calculate maximum rectangle area using red tiles as corners.
+ * @brief Area of the tile rectangle spanned by two corners, sign included.
  *
- * @param redTiles Vector of red tile positions
- * @return Maximum area found
+ * Positive when b lies above and to the right of a (or on the same row or
+ * column), negative when it lies on one side only.
+ *
+ * @param a Lower-left corner candidate
+ * @param b Upper-right corner candidate
+ * @return (b.x - a.x + 1) * (b.y - a.y + 1)
  */
-[[nodiscard]] long long solve(const std::vector<Point> &redTiles)
+[[nodiscard]] constexpr long long corner_area(Point a, Point b) noexcept
 {
+    return (static_cast<long long>(b.x) - a.x + 1) * (static_cast<long long>(b.y) - a.y + 1);
+}
 
-    long long maxArea = 0;
+/**
+ * @struct Staircases
+ * @brief Pareto-extreme tiles of a set, both sorted by ascending x.
+ */
+struct Staircases
+{
+    std::vector<Point> lower; /// No tile lies below-left of these; y strictly decreasing
+    std::vector<Point> upper; /// No tile lies above-right of these; y strictly decreasing
+};
 
-    // Try all pairs of red tiles as opposite corners
-    for (size_t i = 0; i < redTiles.size(); i++)
+/**
+ * @brief Extract the lower-left and upper-right staircases of a tile set.
+ *
+ * The largest rectangle whose lower-left corner is below-left of its
+ * upper-right corner can always be moved onto these tiles: replacing a
+ * corner by a tile that dominates it only grows the rectangle.
+ *
+ * @param tiles Tile positions
+ * @return Both staircases
+ */
+[[nodiscard]] Staircases extract_staircases(std::vector<Point> tiles)
+{
+    Staircases result;
+    std::sort(tiles.begin(), tiles.end());
+
+    for (const Point tile : tiles)
     {
-        for (size_t j = i + 1; j < redTiles.size(); j++)
+        if (result.lower.empty() || tile.y < result.lower.back().y)
         {
-            const Point p1 = redTiles[i];
-            const Point p2 = redTiles[j];
+            result.lower.push_back(tile);
+        }
+    }
 
-            // Calculate rectangle area
-            // The tiles form opposite corners, so we need different x and y coordinates
-            if (p1.x != p2.x && p1.y != p2.y)
-            {
-                long long width = std::abs(p2.x - p1.x) + 1;
-                long long height = std::abs(p2.y - p1.y) + 1;
-                long long area = width * height;
-                maxArea = std::max(maxArea, area);
-            }
+    for (auto it = tiles.rbegin(); it != tiles.rend(); ++it)
+    {
+        if (result.upper.empty() || it->y > result.upper.back().y)
+        {
+            result.upper.push_back(*it);
         }
     }
+    std::reverse(result.upper.begin(), result.upper.end());
 
-    return maxArea;
+    return result;
+}
+
+/**
+ * @struct CornerRow
+ * @brief A lower corner with the upper corners it spans proper rectangles with.
+ *
+ * Upper corners run right and down, so those strictly right of and above
+ * the lower corner form one contiguous index range.
+ */
+struct CornerRow
+{
+    Point lower;  /// Lower-left corner
+    size_t first; /// First upper corner index strictly right of and above it
+    size_t last;  /// Last such upper corner index, inclusive
+};
+
+/**
+ * @brief Pair each lower corner with its range of proper upper corners.
+ *
+ * Both range ends only move right as the lower corner does, so two
+ * pointers find them in one pass. Lower corners without any proper upper
+ * corner are dropped, which keeps both ends non-decreasing.
+ *
+ * @param stairs Both staircases
+ * @return Rows in lower staircase order
+ */
+[[nodiscard]] std::vector<CornerRow> corner_rows(const Staircases &stairs)
+{
+    std::vector<CornerRow> rows;
+    rows.reserve(stairs.lower.size());
+
+    size_t first = 0;
+    size_t end = 0;
+    for (const Point lower : stairs.lower)
+    {
+        while (first < stairs.upper.size() && stairs.upper[first].x <= lower.x)
+        {
+            first++;
+        }
+        while (end < stairs.upper.size() && stairs.upper[end].y > lower.y)
+        {
+            end++;
+        }
+        if (first < end)
+        {
+            rows.push_back({lower, first, end - 1});
+        }
+    }
+    return rows;
+}
+
+/**
+ * @brief Find the best upper corner for a range of lower corners.
+ *
+ * Both staircases run right and down, so corner_area over lower x upper
+ * is a Monge array, and it stays one on the proper ranges of corner_rows()
+ * because their ends never decrease: the best upper corner index never
+ * decreases as the lower corner moves right. Divide and conquer on that
+ * monotone argmax needs O((L + U) log L) area evaluations and only ever
+ * looks at corners differing in both coordinates.
+ *
+ * @param rows Lower corners with their proper upper corner ranges
+ * @param upper Upper staircase
+ * @param rowLo First row index
+ * @param rowHi One past the last row index
+ * @param colLo First candidate upper corner index
+ * @param colHi Last candidate upper corner index, inclusive
+ * @param best Best area found so far, updated in place
+ */
+void search_monotone(const std::vector<CornerRow> &rows, const std::vector<Point> &upper, size_t rowLo,
+                     size_t rowHi, size_t colLo, size_t colHi, long long &best)
+{
+    if (rowLo >= rowHi)
+    {
+        return;
+    }
+
+    const size_t row = rowLo + (rowHi - rowLo) / 2;
+    const CornerRow &candidate = rows[row];
+    const size_t lo = std::max(colLo, candidate.first);
+    const size_t hi = std::min(colHi, candidate.last);
+
+    size_t bestCol = lo;
+    long long rowBest = corner_area(candidate.lower, upper[lo]);
+    for (size_t col = lo + 1; col <= hi; col++)
+    {
+        const long long area = corner_area(candidate.lower, upper[col]);
+        if (area >= rowBest)
+        {
+            rowBest = area;
+            bestCol = col;
+        }
+    }
+    best = std::max(best, rowBest);
+
+    search_monotone(rows, upper, rowLo, row, colLo, bestCol, best);
+    search_monotone(rows, upper, row + 1, rowHi, bestCol, colHi, best);
+}
+
+/**
+ * @brief Largest rectangle with its corners on a rising diagonal.
+ *
+ * Searches lower-left x upper-right staircase pairs with the monotone
+ * divide and conquer, restricted to pairs that differ in both x and y.
+ *
+ * @param tiles Tile positions
+ * @return Largest area of a rectangle with corners a, b where b.x > a.x and b.y > a.y, or 0
+ */
+[[nodiscard]] long long max_rising_area(const std::vector<Point> &tiles)
+{
+    if (tiles.empty())
+    {
+        return 0;
+    }
+
+    const Staircases stairs = extract_staircases(tiles);
+    const std::vector<CornerRow> rows = corner_rows(stairs);
+
+    long long best = 0;
+    search_monotone(rows, stairs.upper, 0, rows.size(), 0, stairs.upper.size() - 1, best);
+    return best;
+}
+
+/**
+ * @brief Calculate maximum rectangle area using red tiles as corners.
+ *
+ * Opposite corners lie either on a rising or on a falling diagonal; the
+ * falling case is the rising one with y mirrored. Each case only pairs
+ * tiles from two opposing staircases, so large floor plans are never
+ * compared pair by pair.
+ *
+ * @param redTiles Vector of red tile positions
+ * @return Maximum area found
+ */
+[[nodiscard]] long long solve(const std::vector<Point> &redTiles)
+{
+    std::vector<Point> mirrored(redTiles);
+    for (Point &tile : mirrored)
+    {
+        tile.y = -tile.y;
+    }
+
+    return std::max(max_rising_area(redTiles), max_rising_area(mirrored));
 }
 
 /**
@@ -109,164 +280,257 @@ struct Point
  *
  * Finds the maximum rectangle area using red tiles as opposite corners.
  *
+ * @param redTiles Red tile positions
+ * @return Maximum rectangle area
+ */
+[[nodiscard]] long long advent_of_code_2025_day9_part1(const std::vector<Point> &redTiles)
+{
+    return solve(redTiles);
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 9 Part 1 from an input file.
+ *
  * @param file_path Path to the input file
  * @return Maximum rectangle area
  * @throws std::runtime_error if the file cannot be read
  */
 [[nodiscard]] long long advent_of_code_2025_day9_part1(const std::filesystem::path &file_path)
 {
-    const auto redTiles = read_input(file_path);
-    return solve(redTiles);
+    return advent_of_code_2025_day9_part1(read_input(file_path));
 }
 
 /**
- * @brief Calculate maximum rectangle area within polygon boundaries.
+ * @class TileRegion
+ * @brief Exact coordinate-compressed map of the tiles inside a rectilinear loop.
  *
- * @param redTiles Vector of red tile positions forming a polygon
- * @return Maximum area found within polygon
+ * Every distinct vertex x (and y) becomes its own band, and every non-empty
+ * gap between consecutive vertex coordinates becomes one more band. All
+ * polygon edges lie on vertex bands, so each compressed cell is either fully
+ * inside, fully on the boundary, or fully outside the loop. Every cell off
+ * the boundary is classified by the crossing parity of one tile it holds, so
+ * outside channels between edges one tile apart, which have no cell of their
+ * own, cannot seal off outside cells. A 2D prefix sum over outside cells then
+ * answers rectangle queries in O(1).
  */
-[[nodiscard]] long long solve_part2(const std::vector<Point> &redTiles)
+class TileRegion
 {
-
-    // Helper function: check if a point is inside the polygon using ray casting
-    auto isInsideOrOnPolygon = [&](int px, int py) -> bool
+public:
+    /**
+     * @brief Compress the loop and classify every cell.
+     *
+     * @param vertices Red tiles in loop order; consecutive tiles share a row or column
+     */
+    explicit TileRegion(const std::vector<Point> &vertices)
     {
-        // First check if on boundary (green tiles - connections between red tiles)
-        for (size_t k = 0; k < redTiles.size(); k++)
+        for (const auto &v : vertices)
         {
-            Point p1 = redTiles[k];
-            Point p2 = redTiles[(k + 1) % redTiles.size()];
-
-            // Check if point is on line segment between p1 and p2
-            if (p1.x == p2.x && p1.x == px)
-            {
-                int minY = std::min(p1.y, p2.y);
-                int maxY = std::max(p1.y, p2.y);
-                if (py >= minY && py <= maxY)
-                    return true;
-            }
-            else if (p1.y == p2.y && p1.y == py)
-            {
-                int minX = std::min(p1.x, p2.x);
-                int maxX = std::max(p1.x, p2.x);
-                if (px >= minX && px <= maxX)
-                    return true;
-            }
+            xs_.push_back(v.x);
+            ys_.push_back(v.y);
         }
+        compress(xs_, xBand_);
+        compress(ys_, yBand_);
 
-        // Check if inside polygon using ray casting
-        int intersections = 0;
-        for (size_t k = 0; k < redTiles.size(); k++)
-        {
-            Point e1 = redTiles[k];
-            Point e2 = redTiles[(k + 1) % redTiles.size()];
+        // One padding band on each side keeps the outside connected
+        width_ = xBand_.back() + 3;
+        height_ = yBand_.back() + 3;
 
-            if ((e1.y > py) != (e2.y > py))
+        std::vector<unsigned char> state(static_cast<std::size_t>(width_) * height_, kUnknown);
+        for (size_t k = 0; k < vertices.size(); k++)
+        {
+            const auto [x1, y1] = cell_of(vertices[k]);
+            const auto [x2, y2] = cell_of(vertices[(k + 1) % vertices.size()]);
+            for (int y = std::min(y1, y2); y <= std::max(y1, y2); y++)
             {
-                double xIntersect = e1.x + (double)(e2.x - e1.x) * (py - e1.y) / (e2.y - e1.y);
-                if (px < xIntersect)
+                for (int x = std::min(x1, x2); x <= std::max(x1, x2); x++)
                 {
-                    intersections++;
+                    state[static_cast<std::size_t>(y) * width_ + x] = kBoundary;
                 }
             }
         }
-        return (intersections % 2) == 1;
-    };
 
-    // Helper: check if rectangle edge intersects polygon edge
-    auto rectangleValid = [&](int minX, int maxX, int minY, int maxY) -> bool
-    {
-        // Check corners first
-        if (!isInsideOrOnPolygon(minX, minY) ||
-            !isInsideOrOnPolygon(maxX, minY) ||
-            !isInsideOrOnPolygon(minX, maxY) ||
-            !isInsideOrOnPolygon(maxX, maxY))
+        classify_outside(vertices, state);
+
+        prefix_.assign(static_cast<std::size_t>(width_ + 1) * (height_ + 1), 0);
+        for (int y = 0; y < height_; y++)
         {
-            return false;
+            for (int x = 0; x < width_; x++)
+            {
+                const int outside = state[static_cast<std::size_t>(y) * width_ + x] == kOutside ? 1 : 0;
+                prefix(x + 1, y + 1) = outside + prefix(x, y + 1) + prefix(x + 1, y) - prefix(x, y);
+            }
         }
+    }
 
-        // Sample edge points to ensure edges stay inside
-        // Sample ~10 points per edge or fewer if edge is short
-        int samplesPerEdge = 10;
+    /**
+     * @brief Get the compressed cell of a vertex.
+     *
+     * @param p A vertex the region was built from
+     * @return Cell column and row, including the padding offset
+     */
+    [[nodiscard]] std::pair<int, int> cell_of(const Point &p) const noexcept
+    {
+        const auto xi = std::lower_bound(xs_.begin(), xs_.end(), p.x) - xs_.begin();
+        const auto yi = std::lower_bound(ys_.begin(), ys_.end(), p.y) - ys_.begin();
+        return {xBand_[xi] + 1, yBand_[yi] + 1};
+    }
 
-        // Top and bottom edges
-        int stepX = std::max(1, (maxX - minX) / samplesPerEdge);
-        for (int x = minX; x <= maxX; x += stepX)
+    /**
+     * @brief Check whether a rectangle of cells lies entirely inside or on the loop.
+     *
+     * @param a One corner cell
+     * @param b Opposite corner cell
+     * @return True if no cell in the rectangle is outside
+     */
+    [[nodiscard]] bool contains(const std::pair<int, int> &a, const std::pair<int, int> &b) const noexcept
+    {
+        const int x1 = std::min(a.first, b.first);
+        const int x2 = std::max(a.first, b.first) + 1;
+        const int y1 = std::min(a.second, b.second);
+        const int y2 = std::max(a.second, b.second) + 1;
+        return prefix(x2, y2) - prefix(x1, y2) - prefix(x2, y1) + prefix(x1, y1) == 0;
+    }
+
+private:
+    static constexpr unsigned char kUnknown = 0;
+    static constexpr unsigned char kBoundary = 1;
+    static constexpr unsigned char kOutside = 2;
+
+    /**
+     * @brief Sort and deduplicate coordinates and assign each its band index.
+     *
+     * Each coordinate gets its own band, and a gap of at least one tile
+     * between neighbouring coordinates gets a band of its own in between.
+     *
+     * @param coords Coordinates to compress, replaced by their sorted unique values
+     * @param bands Receives the band index of each unique coordinate
+     */
+    static void compress(std::vector<int> &coords, std::vector<int> &bands)
+    {
+        std::sort(coords.begin(), coords.end());
+        coords.erase(std::unique(coords.begin(), coords.end()), coords.end());
+
+        bands.resize(coords.size());
+        int band = 0;
+        for (size_t k = 0; k < coords.size(); k++)
         {
-            if (!isInsideOrOnPolygon(x, minY) || !isInsideOrOnPolygon(x, maxY))
+            if (k > 0)
             {
-                return false;
+                band += coords[k] - coords[k - 1] > 1 ? 2 : 1;
             }
+            bands[k] = band;
         }
-        // Make sure we check the last point
-        if (!isInsideOrOnPolygon(maxX, minY) || !isInsideOrOnPolygon(maxX, maxY))
-        {
-            return false;
-        }
+    }
 
-        // Left and right edges
-        int stepY = std::max(1, (maxY - minY) / samplesPerEdge);
-        for (int y = minY; y <= maxY; y += stepY)
+    /**
+     * @brief Pick one tile of every band, padding bands included.
+     *
+     * @param coords Sorted unique coordinates
+     * @param bands Band index of each coordinate
+     * @param cells Number of cells along the axis, including padding
+     * @return Coordinate of a tile in each cell along the axis
+     */
+    [[nodiscard]] static std::vector<int> representatives(const std::vector<int> &coords, const std::vector<int> &bands,
+                                                          int cells)
+    {
+        std::vector<int> tiles(cells);
+        tiles.front() = coords.front() - 1;
+        tiles.back() = coords.back() + 1;
+        for (size_t k = 0; k < coords.size(); k++)
         {
-            if (!isInsideOrOnPolygon(minX, y) || !isInsideOrOnPolygon(maxX, y))
+            tiles[bands[k] + 1] = coords[k];
+            if (k > 0 && bands[k] - bands[k - 1] == 2)
             {
-                return false;
+                tiles[bands[k]] = coords[k - 1] + 1;
             }
         }
-        // Make sure we check the last point
-        if (!isInsideOrOnPolygon(minX, maxY) || !isInsideOrOnPolygon(maxX, maxY))
-        {
-            return false;
-        }
+        return tiles;
+    }
 
-        // Check if any polygon edge crosses through rectangle interior
-        for (size_t k = 0; k < redTiles.size(); k++)
+    /**
+     * @brief Mark every cell off the boundary whose tiles lie outside the loop.
+     *
+     * A tile is outside if a ray from it towards -x crosses the vertical
+     * edges an even number of times. Edges count with a half-open row range,
+     * which is exact for every tile that is not on the boundary itself. Each
+     * cell row sorts its crossings once and sweeps its cells left to right.
+     *
+     * @param vertices Red tiles in loop order
+     * @param state Cell states, updated in place
+     */
+    void classify_outside(const std::vector<Point> &vertices, std::vector<unsigned char> &state) const
+    {
+        const std::vector<int> xTile = representatives(xs_, xBand_, width_);
+        const std::vector<int> yTile = representatives(ys_, yBand_, height_);
+
+        std::vector<int> crossings;
+        for (int y = 0; y < height_; y++)
         {
-            Point p1 = redTiles[k];
-            Point p2 = redTiles[(k + 1) % redTiles.size()];
-
-            int edgeMinX = std::min(p1.x, p2.x);
-            int edgeMaxX = std::max(p1.x, p2.x);
-            int edgeMinY = std::min(p1.y, p2.y);
-            int edgeMaxY = std::max(p1.y, p2.y);
-
-            // If edge passes through rectangle interior, it's bad
-            if (p1.x == p2.x)
-            { // Vertical edge
-                int x = p1.x;
-                if (x > minX && x < maxX)
+            const int py = yTile[y];
+            crossings.clear();
+            for (size_t k = 0; k < vertices.size(); k++)
+            {
+                const Point &a = vertices[k];
+                const Point &b = vertices[(k + 1) % vertices.size()];
+                if (a.x == b.x && (a.y <= py) != (b.y <= py))
                 {
-                    if (edgeMinY < maxY && edgeMaxY > minY)
-                    {
-                        int crossMinY = std::max(edgeMinY, minY);
-                        int crossMaxY = std::min(edgeMaxY, maxY);
-                        if (crossMinY < crossMaxY)
-                        {
-                            return false;
-                        }
-                    }
+                    crossings.push_back(a.x);
                 }
             }
-            else if (p1.y == p2.y)
-            { // Horizontal edge
-                int y = p1.y;
-                if (y > minY && y < maxY)
+            std::sort(crossings.begin(), crossings.end());
+
+            size_t left = 0; // Crossings strictly left of the current tile
+            for (int x = 0; x < width_; x++)
+            {
+                while (left < crossings.size() && crossings[left] < xTile[x])
+                {
+                    left++;
+                }
+                unsigned char &cell = state[static_cast<std::size_t>(y) * width_ + x];
+                if (cell == kUnknown && left % 2 == 0)
                 {
-                    if (edgeMinX < maxX && edgeMaxX > minX)
-                    {
-                        int crossMinX = std::max(edgeMinX, minX);
-                        int crossMaxX = std::min(edgeMaxX, maxX);
-                        if (crossMinX < crossMaxX)
-                        {
-                            return false;
-                        }
-                    }
+                    cell = kOutside;
                 }
             }
         }
+    }
 
-        return true;
-    };
+    [[nodiscard]] int &prefix(int x, int y) noexcept { return prefix_[static_cast<std::size_t>(y) * (width_ + 1) + x]; }
+    [[nodiscard]] int prefix(int x, int y) const noexcept { return prefix_[static_cast<std::size_t>(y) * (width_ + 1) + x]; }
+
+    std::vector<int> xs_;      ///< Distinct vertex x values, sorted
+    std::vector<int> ys_;      ///< Distinct vertex y values, sorted
+    std::vector<int> xBand_;   ///< Band index of each value in xs_
+    std::vector<int> yBand_;   ///< Band index of each value in ys_
+    int width_ = 0;            ///< Cell columns including padding
+    int height_ = 0;           ///< Cell rows including padding
+    std::vector<int> prefix_;  ///< Inclusive prefix counts of outside cells
+};
+
+/**
+ * @brief Calculate maximum rectangle area within polygon boundaries.
+ *
+ * Each candidate rectangle is tested exactly in O(1) against the compressed
+ * region, so the whole search is O(n^2) after an O(n^2) build.
+ *
+ * @param redTiles Vector of red tile positions forming a polygon
+ * @return Maximum area found within polygon
+ */
+[[nodiscard]] long long solve_part2(const std::vector<Point> &redTiles)
+{
+    if (redTiles.empty())
+    {
+        return 0;
+    }
+
+    const TileRegion region(redTiles);
+
+    std::vector<std::pair<int, int>> cells;
+    cells.reserve(redTiles.size());
+    for (const auto &tile : redTiles)
+    {
+        cells.push_back(region.cell_of(tile));
+    }
 
     long long maxArea = 0;
 
@@ -281,21 +545,15 @@ struct Point
             if (p1.x == p2.x || p1.y == p2.y)
                 continue;
 
-            const int minRectX = std::min(p1.x, p2.x);
-            const int maxRectX = std::max(p1.x, p2.x);
-            const int minRectY = std::min(p1.y, p2.y);
-            const int maxRectY = std::max(p1.y, p2.y);
+            const long long width = std::abs(static_cast<long long>(p2.x) - p1.x) + 1;
+            const long long height = std::abs(static_cast<long long>(p2.y) - p1.y) + 1;
+            const long long area = width * height;
 
-            // Check if rectangle is valid (all points inside or on polygon)
-            if (!rectangleValid(minRectX, maxRectX, minRectY, maxRectY))
+            // Only pay for the containment test when the rectangle would win
+            if (area > maxArea && region.contains(cells[i], cells[j]))
             {
-                continue;
+                maxArea = area;
             }
-
-            const long long width = static_cast<long long>(maxRectX) - minRectX + 1;
-            const long long height = static_cast<long long>(maxRectY) - minRectY + 1;
-            const long long area = width * height;
-            maxArea = std::max(maxArea, area);
         }
     }
 
@@ -308,26 +566,62 @@ struct Point
  * Finds the maximum rectangle area that fits entirely within the polygon
  * formed by red tiles.
  *
+ * @param redTiles Red tile positions
+ * @return Maximum rectangle area within polygon
+ */
+[[nodiscard]] long long advent_of_code_2025_day9_part2(const std::vector<Point> &redTiles)
+{
+    return solve_part2(redTiles);
+}
+
+/**
+ * @brief Solve Advent of Code 2025 Day 9 Part 2 from an input file.
+ *
  * @param file_path Path to the input file
  * @return Maximum rectangle area within polygon
  * @throws std::runtime_error if the file cannot be read
  */
 [[nodiscard]] long long advent_of_code_2025_day9_part2(const std::filesystem::path &file_path)
 {
-    const auto redTiles = read_input(file_path);
-    return solve_part2(redTiles);
+    return advent_of_code_2025_day9_part2(read_input(file_path));
 }
 
+/**
+ * @brief Solve both parts of Advent of Code 2025 Day 9 from an input file.
+ *
+ * The input is parsed once and both solvers run concurrently on it.
+ *
+ * @param file_path Path to the input file
+ * @return Part 1 and Part 2 answers
+ * @throws std::runtime_error if the file cannot be read or a solver fails
+ */
+[[nodiscard]] auto solve_both_parts(const std::filesystem::path &file_path)
+{
+    return aoc::solve_parts(
+        read_input(file_path),
+        [](const auto &input)
+        { return advent_of_code_2025_day9_part1(input); },
+        [](const auto &input)
+        { return advent_of_code_2025_day9_part2(input); });
+}
+
+} // namespace aoc2025::day9
+
+#ifndef AOC_RUNNER
 /**
  * @brief Main entry point of the program.
  *
  * Executes both parts of the Advent of Code 2025 Day 9 challenge on both
- * the example input and the actual input files. Prints results to stdout.
+ * the example input and the actual input files, then checks Part 1 on the
+ * same-row staircase regression input and Part 2 on the narrow-channel one.
+ * Prints results to stdout.
  *
- * @return 0 on success, 1 if an exception is caught
+ * @return 0 on success, 1 if an exception is caught or the regression fails
  */
 int main()
 {
+    using namespace aoc2025::day9;
+
     try
     {
         const std::filesystem::path example_file = "input_example.txt";
@@ -335,21 +629,41 @@ int main()
 
         std::cout << "=== input_example.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1_example = advent_of_code_2025_day9_part1(example_file);
+        const auto [result1_example, result2_example] = solve_both_parts(example_file);
         std::cout << "Maximum rectangle area: " << result1_example << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2_example = advent_of_code_2025_day9_part2(example_file);
         std::cout << "Maximum rectangle area within polygon: " << result2_example << std::endl;
 
         std::cout << "\n=== input.txt ===" << std::endl;
         std::cout << "=== Part 1 ===" << std::endl;
-        const auto result1 = advent_of_code_2025_day9_part1(input_file);
+        const auto [result1, result2] = solve_both_parts(input_file);
         std::cout << "Maximum rectangle area: " << result1 << std::endl;
 
         std::cout << "=== Part 2 ===" << std::endl;
-        const auto result2 = advent_of_code_2025_day9_part2(input_file);
         std::cout << "Maximum rectangle area within polygon: " << result2 << std::endl;
+
+        // Two long staircases whose widest corner pair shares a row
+        const std::filesystem::path staircase_file = "input_staircase.txt";
+        const long long staircase = advent_of_code_2025_day9_part1(staircase_file);
+        std::cout << "\n=== input_staircase.txt ===" << std::endl;
+        std::cout << "Maximum rectangle area: " << staircase << std::endl;
+        if (staircase != 4017008001)
+        {
+            std::cerr << "Regression: expected 4017008001" << std::endl;
+            return 1;
+        }
+
+        // Outside notch whose only opening is between edges one tile apart
+        const std::filesystem::path channel_file = "input_channel.txt";
+        const long long channel = advent_of_code_2025_day9_part2(channel_file);
+        std::cout << "\n=== input_channel.txt ===" << std::endl;
+        std::cout << "Maximum rectangle area within polygon: " << channel << std::endl;
+        if (channel != 30)
+        {
+            std::cerr << "Regression: expected 30" << std::endl;
+            return 1;
+        }
     }
     catch (const std::exception &e)
     {
@@ -358,4 +672,5 @@ int main()
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // AOC_RUNNER
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <ostream>
+
+namespace aoc
+{
+
+/**
+ * @class BigUint
+ * @brief Unsigned integer for counting problems whose totals may exceed 64 bits.
+ *
+ * Values are kept in a native unsigned __int128 for as long as they fit; an
+ * addition that overflows promotes the value to a little-endian vector of
+ * 64-bit limbs. Additions are done in place and the value is only converted
+ * to decimal when it is printed.
+ */
+class BigUint
+{
+public:
+    using Native = unsigned __int128;
+
+    constexpr BigUint(std::uint64_t value = 0) noexcept : small_(value) {}
+
+    /**
+     * @brief Add another value in place.
+     *
+     * @param other Value to add
+     * @return Reference to this value
+     */
+    BigUint &operator+=(const BigUint &other)
+    {
+        if (limbs_.empty() && other.limbs_.empty())
+        {
+            const Native sum = small_ + other.small_;
+            if (sum >= small_)
+            {
+                small_ = sum;
+                return *this;
+            }
+        }
+
+        promote();
+        add_limbs(other.limbs_.empty() ? split(other.small_) : other.limbs_);
+        return *this;
+    }
+
+    [[nodiscard]] friend BigUint operator+(BigUint lhs, const BigUint &rhs)
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    [[nodiscard]] friend bool operator==(const BigUint &lhs, const BigUint &rhs)
+    {
+        if (lhs.limbs_.empty() && rhs.limbs_.empty())
+        {
+            return lhs.small_ == rhs.small_;
+        }
+        return lhs.normalized_limbs() == rhs.normalized_limbs();
+    }
+
+    /**
+     * @brief Check whether the value still fits in the native 128-bit type.
+     * @return True until an addition has overflowed 128 bits
+     */
+    [[nodiscard]] bool is_native() const noexcept { return limbs_.empty(); }
+
+    /**
+     * @brief Convert the value to its decimal representation.
+     * @return Decimal digits without leading zeros
+     */
+    [[nodiscard]] std::string to_string() const
+    {
+        constexpr std::uint64_t kChunk = 10'000'000'000'000'000'000ULL; // 10^19
+        constexpr int kChunkDigits = 19;
+
+        std::vector<std::uint64_t> value = limbs_.empty() ? split(small_) : limbs_;
+        std::vector<std::uint64_t> chunks; // base 10^19 digits, least significant first
+
+        while (!value.empty())
+        {
+            // Long division of the limb vector by 10^19
+            Native remainder = 0;
+            for (auto it = value.rbegin(); it != value.rend(); ++it)
+            {
+                const Native current = (remainder << 64) | *it;
+                *it = static_cast<std::uint64_t>(current / kChunk);
+                remainder = current % kChunk;
+            }
+            chunks.push_back(static_cast<std::uint64_t>(remainder));
+
+            while (!value.empty() && value.back() == 0)
+            {
+                value.pop_back();
+            }
+        }
+
+        if (chunks.empty())
+        {
+            return "0";
+        }
+
+        std::string result = std::to_string(chunks.back());
+        for (auto it = chunks.rbegin() + 1; it != chunks.rend(); ++it)
+        {
+            const std::string digits = std::to_string(*it);
+            result.append(kChunkDigits - digits.size(), '0');
+            result += digits;
+        }
+        return result;
+    }
+
+    friend std::ostream &operator<<(std::ostream &out, const BigUint &value)
+    {
+        return out << value.to_string();
+    }
+
+private:
+    [[nodiscard]] static std::vector<std::uint64_t> split(Native value)
+    {
+        std::vector<std::uint64_t> limbs;
+        while (value != 0)
+        {
+            limbs.push_back(static_cast<std::uint64_t>(value));
+            value >>= 64;
+        }
+        return limbs;
+    }
+
+    [[nodiscard]] std::vector<std::uint64_t> normalized_limbs() const
+    {
+        auto limbs = limbs_.empty() ? split(small_) : limbs_;
+        while (!limbs.empty() && limbs.back() == 0)
+        {
+            limbs.pop_back();
+        }
+        return limbs;
+    }
+
+    void promote()
+    {
+        if (limbs_.empty())
+        {
+            limbs_ = split(small_);
+            small_ = 0;
+        }
+    }
+
+    void add_limbs(const std::vector<std::uint64_t> &other)
+    {
+        if (limbs_.size() < other.size())
+        {
+            limbs_.resize(other.size(), 0);
+        }
+
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < limbs_.size(); ++i)
+        {
+            const Native sum = static_cast<Native>(limbs_[i]) + (i < other.size() ? other[i] : 0) + carry;
+            limbs_[i] = static_cast<std::uint64_t>(sum);
+            carry = static_cast<std::uint64_t>(sum >> 64);
+            if (carry == 0 && i >= other.size())
+            {
+                break;
+            }
+        }
+        if (carry != 0)
+        {
+            limbs_.push_back(carry);
+        }
+    }
+
+    Native small_ = 0;                 ///< Value while it fits in 128 bits
+    std::vector<std::uint64_t> limbs_; ///< Little-endian limbs once the value has overflowed
+};
+
+} // namespace aoc
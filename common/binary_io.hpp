@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace aoc
+{
+
+/**
+ * @class BinaryWriter
+ * @brief Appends trivially copyable values to a byte buffer.
+ *
+ * Values are stored in native byte order without padding, so the format is
+ * meant for caches on the machine that wrote them, not for exchange.
+ */
+class BinaryWriter
+{
+public:
+    /**
+     * @brief Append one value.
+     * @param value Value to store
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(const T &value)
+    {
+        bytes_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    /**
+     * @brief Append a length-prefixed array of values.
+     * @param values Values to store
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write_span(std::span<const T> values)
+    {
+        write<std::uint64_t>(values.size());
+        bytes_.append(reinterpret_cast<const char *>(values.data()), values.size_bytes());
+    }
+
+    /**
+     * @brief Append a length-prefixed vector of values, read back by BinaryReader::read_vector().
+     * @param values Values to store
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write_vector(const std::vector<T> &values)
+    {
+        write_span(std::span<const T>(values));
+    }
+
+    /**
+     * @brief Append a length-prefixed string.
+     * @param text Text to store
+     */
+    void write_string(std::string_view text) { write_span(std::span<const char>(text.data(), text.size())); }
+
+    /**
+     * @brief Get everything written so far.
+     * @return Byte buffer
+     */
+    [[nodiscard]] const std::string &bytes() const noexcept { return bytes_; }
+
+private:
+    std::string bytes_; ///< Written bytes
+};
+
+/**
+ * @class BinaryReader
+ * @brief Reads back values written by BinaryWriter from a byte view.
+ *
+ * Every read is bounds-checked, so a truncated or corrupt buffer raises an
+ * exception instead of reading past its end.
+ */
+class BinaryReader
+{
+public:
+    /**
+     * @brief Start reading a buffer.
+     * @param bytes Buffer to read; must outlive the reader
+     */
+    explicit BinaryReader(std::string_view bytes) noexcept : bytes_(bytes) {}
+
+    /**
+     * @brief Read one value.
+     *
+     * @return The value
+     * @throws std::runtime_error if the buffer ends first
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] T read()
+    {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Read a length-prefixed array of values.
+     *
+     * @return The values
+     * @throws std::runtime_error if the buffer ends first
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] std::vector<T> read_vector()
+    {
+        const auto count = read<std::uint64_t>();
+        if (count > remaining() / sizeof(T))
+        {
+            throw std::runtime_error("Truncated binary data");
+        }
+        std::vector<T> values(count);
+        if (count > 0)
+        {
+            std::memcpy(values.data(), take(count * sizeof(T)), count * sizeof(T));
+        }
+        return values;
+    }
+
+    /**
+     * @brief Read a length-prefixed string.
+     *
+     * @return The string
+     * @throws std::runtime_error if the buffer ends first
+     */
+    [[nodiscard]] std::string read_string()
+    {
+        const auto size = read<std::uint64_t>();
+        if (size > remaining())
+        {
+            throw std::runtime_error("Truncated binary data");
+        }
+        return std::string(take(size), size);
+    }
+
+    /**
+     * @brief Get the number of unread bytes.
+     * @return Bytes left
+     */
+    [[nodiscard]] std::size_t remaining() const noexcept { return bytes_.size() - offset_; }
+
+private:
+    /**
+     * @brief Consume raw bytes.
+     *
+     * @param size Number of bytes
+     * @return Pointer to the first consumed byte
+     * @throws std::runtime_error if fewer bytes are left
+     */
+    const char *take(std::size_t size)
+    {
+        if (size > remaining())
+        {
+            throw std::runtime_error("Truncated binary data");
+        }
+        const char *data = bytes_.data() + offset_;
+        offset_ += size;
+        return data;
+    }
+
+    std::string_view bytes_; ///< Buffer being read
+    std::size_t offset_ = 0; ///< Bytes consumed so far
+};
+
+} // namespace aoc
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "binary_io.hpp"
+
+namespace aoc
+{
+
+/**
+ * @class Digraph
+ * @brief Directed graph with interned node names and CSR adjacency.
+ *
+ * Node names are mapped to dense ids 0..n-1 while the graph is built, and
+ * the successors of every node are stored contiguously in one array
+ * indexed by per-node offsets. Algorithms work on ids only; names are kept
+ * for lookups and error messages.
+ */
+class Digraph
+{
+    /// Hash that lets string-keyed maps be searched with a string_view
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] std::size_t operator()(std::string_view name) const noexcept
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    using NameIndex = std::unordered_map<std::string, int, NameHash, std::equal_to<>>;
+
+public:
+    /// Id returned for names that are not in the graph
+    static constexpr int kNoNode = -1;
+
+    /**
+     * @class Builder
+     * @brief Collects named nodes and edges, then packs them into a Digraph.
+     */
+    class Builder
+    {
+    public:
+        /**
+         * @brief Get the id of a node, adding it if it is new.
+         *
+         * @param name Node name
+         * @return Dense node id
+         */
+        int intern(std::string_view name)
+        {
+            if (const auto it = ids_.find(name); it != ids_.end())
+            {
+                return it->second;
+            }
+            const int id = static_cast<int>(names_.size());
+            names_.emplace_back(name);
+            ids_.emplace(names_.back(), id);
+            return id;
+        }
+
+        /**
+         * @brief Add a directed edge between two interned nodes.
+         *
+         * @param from Source node id
+         * @param to Target node id
+         */
+        void add_edge(int from, int to) { edges_.emplace_back(from, to); }
+
+        /**
+         * @brief Pack the collected edges into CSR form.
+         *
+         * Successors keep the order in which their edges were added.
+         *
+         * @return The finished graph; the builder is left empty
+         */
+        [[nodiscard]] Digraph build() &&
+        {
+            Digraph graph;
+            const std::size_t n = names_.size();
+
+            graph.offsets_.assign(n + 1, 0);
+            for (const auto &[from, to] : edges_)
+            {
+                ++graph.offsets_[from + 1];
+            }
+            for (std::size_t v = 0; v < n; ++v)
+            {
+                graph.offsets_[v + 1] += graph.offsets_[v];
+            }
+
+            graph.targets_.resize(edges_.size());
+            std::vector<int> cursor(graph.offsets_.begin(), graph.offsets_.end() - 1);
+            for (const auto &[from, to] : edges_)
+            {
+                graph.targets_[cursor[from]++] = to;
+            }
+
+            graph.names_ = std::move(names_);
+            graph.ids_ = std::move(ids_);
+            edges_.clear();
+            return graph;
+        }
+
+    private:
+        std::vector<std::string> names_;           ///< Name of each node id
+        NameIndex ids_;                            ///< Id of each name
+        std::vector<std::pair<int, int>> edges_;   ///< Edges in insertion order
+    };
+
+    /**
+     * @brief Get the number of nodes.
+     * @return Node count
+     */
+    [[nodiscard]] int node_count() const noexcept { return static_cast<int>(names_.size()); }
+
+    /**
+     * @brief Get the number of edges.
+     * @return Edge count
+     */
+    [[nodiscard]] std::size_t edge_count() const noexcept { return targets_.size(); }
+
+    /**
+     * @brief Look up a node by name.
+     *
+     * @param name Node name
+     * @return Node id, or kNoNode if the name never appeared
+     */
+    [[nodiscard]] int find(std::string_view name) const
+    {
+        const auto it = ids_.find(name);
+        return it == ids_.end() ? kNoNode : it->second;
+    }
+
+    /**
+     * @brief Get the name of a node.
+     *
+     * @param node Node id
+     * @return Name the node was interned with
+     */
+    [[nodiscard]] const std::string &name(int node) const { return names_[node]; }
+
+    /**
+     * @brief Get the successors of a node.
+     *
+     * @param node Node id
+     * @return Contiguous view of the targets of its outgoing edges
+     */
+    [[nodiscard]] std::span<const int> successors(int node) const noexcept
+    {
+        return {targets_.data() + offsets_[node], targets_.data() + offsets_[node + 1]};
+    }
+
+    /**
+     * @brief Order all nodes so that every edge points forward.
+     *
+     * Kahn's algorithm over in-degrees; ties keep ascending id order.
+     *
+     * @return Node ids in topological order
+     * @throws std::runtime_error if the graph contains a cycle
+     */
+    [[nodiscard]] std::vector<int> topological_order() const
+    {
+        const int n = node_count();
+        std::vector<int> indegree(n, 0);
+        for (const int to : targets_)
+        {
+            ++indegree[to];
+        }
+
+        std::vector<int> order;
+        order.reserve(n);
+        for (int v = 0; v < n; ++v)
+        {
+            if (indegree[v] == 0)
+            {
+                order.push_back(v);
+            }
+        }
+        for (std::size_t head = 0; head < order.size(); ++head)
+        {
+            for (const int next : successors(order[head]))
+            {
+                if (--indegree[next] == 0)
+                {
+                    order.push_back(next);
+                }
+            }
+        }
+
+        if (static_cast<int>(order.size()) != n)
+        {
+            throw std::runtime_error("Graph contains a cycle");
+        }
+        return order;
+    }
+
+    /**
+     * @brief Visit every node reachable from a source in post-order.
+     *
+     * Uses an explicit stack, so deep graphs cannot overflow the call stack.
+     * Each node is visited after all of its successors, which is a reverse
+     * topological order of the reachable part of the graph.
+     *
+     * @param source Node id to start from
+     * @param visit Callable taking a node id
+     * @throws std::runtime_error if a cycle is reachable from the source
+     */
+    template <typename Visit>
+    void post_order_from(int source, Visit &&visit) const
+    {
+        enum : unsigned char
+        {
+            kUnseen,
+            kOnStack,
+            kDone
+        };
+        std::vector<unsigned char> state(names_.size(), kUnseen);
+        std::vector<std::pair<int, int>> stack; // node, next offset to explore
+
+        state[source] = kOnStack;
+        stack.emplace_back(source, offsets_[source]);
+        while (!stack.empty())
+        {
+            auto &[node, next] = stack.back();
+            if (next == offsets_[node + 1])
+            {
+                state[node] = kDone;
+                const int finished = node;
+                stack.pop_back();
+                visit(finished);
+                continue;
+            }
+
+            const int successor = targets_[next++];
+            if (state[successor] == kOnStack)
+            {
+                throw std::runtime_error("Graph contains a cycle through " + names_[successor]);
+            }
+            if (state[successor] == kUnseen)
+            {
+                state[successor] = kOnStack;
+                stack.emplace_back(successor, offsets_[successor]);
+            }
+        }
+    }
+
+    /**
+     * @brief Serialize a graph, e.g. for the parse cache.
+     *
+     * @param writer Destination
+     * @param graph Graph to store
+     */
+    friend void save(BinaryWriter &writer, const Digraph &graph)
+    {
+        writer.write<std::uint64_t>(graph.names_.size());
+        for (const auto &name : graph.names_)
+        {
+            writer.write_string(name);
+        }
+        writer.write_vector(graph.offsets_);
+        writer.write_vector(graph.targets_);
+    }
+
+    /**
+     * @brief Deserialize a graph written by save().
+     *
+     * The name index is rebuilt from the stored names.
+     *
+     * @param reader Source
+     * @param graph Receives the graph
+     * @throws std::runtime_error if the data is truncated or inconsistent
+     */
+    friend void load(BinaryReader &reader, Digraph &graph)
+    {
+        graph.names_.resize(reader.read<std::uint64_t>());
+        for (auto &name : graph.names_)
+        {
+            name = reader.read_string();
+        }
+        graph.offsets_ = reader.read_vector<int>();
+        graph.targets_ = reader.read_vector<int>();
+
+        const std::size_t n = graph.names_.size();
+        if (graph.offsets_.size() != n + 1 || graph.offsets_.front() != 0 ||
+            static_cast<std::size_t>(graph.offsets_.back()) != graph.targets_.size())
+        {
+            throw std::runtime_error("Inconsistent graph data");
+        }
+
+        graph.ids_.clear();
+        graph.ids_.reserve(n);
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            graph.ids_.emplace(graph.names_[v], static_cast<int>(v));
+        }
+    }
+
+private:
+    std::vector<std::string> names_; ///< Name of each node id
+    NameIndex ids_;                  ///< Id of each name
+    std::vector<int> offsets_;       ///< Start of each node's successors in targets_, plus end sentinel
+    std::vector<int> targets_;       ///< Successor ids of all nodes, grouped by source
+};
+
+} // namespace aoc
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace aoc
+{
+
+/**
+ * @brief Count the 8-neighbours of every cell of one row of a 0/1 byte plane.
+ *
+ * The rows above and below and one cell left and right of every row must
+ * be readable, which a padded plane guarantees. Vector lanes handle 32
+ * (AVX2) or 16 (NEON) cells per step with plain byte adds, since a count
+ * never exceeds 8; the rest of the row is done by the scalar loop.
+ *
+ * @param up First cell of the row above
+ * @param mid First cell of the row itself
+ * @param down First cell of the row below
+ * @param out Receives one count per cell
+ * @param cols Number of cells in the row
+ */
+inline void neighbour_count_row(const std::uint8_t *up, const std::uint8_t *mid, const std::uint8_t *down,
+                                std::uint8_t *out, int cols) noexcept
+{
+    int j = 0;
+#if defined(__AVX2__)
+    const auto load = [](const std::uint8_t *p)
+    { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); };
+    for (; j + 32 <= cols; j += 32)
+    {
+        __m256i sum = _mm256_add_epi8(load(up + j - 1), load(up + j));
+        sum = _mm256_add_epi8(sum, load(up + j + 1));
+        sum = _mm256_add_epi8(sum, load(mid + j - 1));
+        sum = _mm256_add_epi8(sum, load(mid + j + 1));
+        sum = _mm256_add_epi8(sum, load(down + j - 1));
+        sum = _mm256_add_epi8(sum, load(down + j));
+        sum = _mm256_add_epi8(sum, load(down + j + 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + j), sum);
+    }
+#elif defined(__ARM_NEON)
+    for (; j + 16 <= cols; j += 16)
+    {
+        uint8x16_t sum = vaddq_u8(vld1q_u8(up + j - 1), vld1q_u8(up + j));
+        sum = vaddq_u8(sum, vld1q_u8(up + j + 1));
+        sum = vaddq_u8(sum, vld1q_u8(mid + j - 1));
+        sum = vaddq_u8(sum, vld1q_u8(mid + j + 1));
+        sum = vaddq_u8(sum, vld1q_u8(down + j - 1));
+        sum = vaddq_u8(sum, vld1q_u8(down + j));
+        sum = vaddq_u8(sum, vld1q_u8(down + j + 1));
+        vst1q_u8(out + j, sum);
+    }
+#endif
+    for (; j < cols; ++j)
+    {
+        out[j] = static_cast<std::uint8_t>(up[j - 1] + up[j] + up[j + 1] + mid[j - 1] + mid[j + 1] +
+                                           down[j - 1] + down[j] + down[j + 1]);
+    }
+}
+
+/**
+ * @class BytePlane
+ * @brief Contiguous grid of byte cells with a one-cell zero border.
+ *
+ * Cell (i, j) is stored at flat index (i + 1) * stride() + (j + 1), so every
+ * real cell has all 8 neighbours in memory and stencils need no bounds
+ * checks. Neighbours of a flat index are plain offsets of +-1 and +-stride().
+ */
+class BytePlane
+{
+public:
+    BytePlane() = default;
+
+    /**
+     * @brief Create a zero-filled plane.
+     *
+     * @param rows Number of rows
+     * @param cols Number of columns
+     */
+    BytePlane(int rows, int cols)
+        : rows_(rows), cols_(cols), stride_(cols + 2), cells_(static_cast<std::size_t>(rows + 2) * (cols + 2), 0)
+    {
+    }
+
+    /**
+     * @brief Build a 0/1 plane marking one character in lines of text.
+     *
+     * The plane is as wide as the longest line; shorter lines are padded
+     * with zeros.
+     *
+     * @param lines Sequence of string_view-convertible rows
+     * @param marker Character that becomes a 1 cell
+     * @return Plane with 1 wherever the marker appears
+     */
+    template <typename Lines>
+    [[nodiscard]] static BytePlane from_lines(const Lines &lines, char marker)
+    {
+        int rows = 0;
+        std::size_t cols = 0;
+        for (const std::string_view line : lines)
+        {
+            ++rows;
+            cols = std::max(cols, line.size());
+        }
+
+        BytePlane plane(rows, static_cast<int>(cols));
+        int i = 0;
+        for (const std::string_view line : lines)
+        {
+            std::uint8_t *cells = plane.row(i++);
+            for (std::size_t j = 0; j < line.size(); ++j)
+            {
+                cells[j] = line[j] == marker ? 1 : 0;
+            }
+        }
+        return plane;
+    }
+
+    /**
+     * @brief Count the set 8-neighbours of every cell.
+     *
+     * Runs the vectorized stencil one row at a time. Values must be 0 or 1.
+     *
+     * @return Plane of the same shape holding the counts; the border stays zero
+     */
+    [[nodiscard]] BytePlane neighbour_counts() const
+    {
+        BytePlane counts(rows_, cols_);
+        for (int i = 0; i < rows_; ++i)
+        {
+            neighbour_count_row(row(i) - stride_, row(i), row(i) + stride_, counts.row(i), cols_);
+        }
+        return counts;
+    }
+
+    /**
+     * @brief Get the number of rows.
+     * @return Row count, excluding the border
+     */
+    [[nodiscard]] int rows() const noexcept { return rows_; }
+
+    /**
+     * @brief Get the number of columns.
+     * @return Column count, excluding the border
+     */
+    [[nodiscard]] int cols() const noexcept { return cols_; }
+
+    /**
+     * @brief Get the distance between vertically adjacent cells.
+     * @return Row stride of the flat layout
+     */
+    [[nodiscard]] int stride() const noexcept { return stride_; }
+
+    /**
+     * @brief Get the flat index of a cell.
+     *
+     * @param i Row, -1..rows() for the border
+     * @param j Column, -1..cols() for the border
+     * @return Index into data()
+     */
+    [[nodiscard]] std::size_t index(int i, int j) const noexcept
+    {
+        return static_cast<std::size_t>(i + 1) * stride_ + (j + 1);
+    }
+
+    /**
+     * @brief Access the flat buffer, border included.
+     * @return Pointer to the first border cell
+     */
+    [[nodiscard]] std::uint8_t *data() noexcept { return cells_.data(); }
+    [[nodiscard]] const std::uint8_t *data() const noexcept { return cells_.data(); }
+
+    /**
+     * @brief Access the first real cell of a row.
+     *
+     * @param i Row index
+     * @return Pointer to cell (i, 0); cells -1 and cols() belong to the border
+     */
+    [[nodiscard]] std::uint8_t *row(int i) noexcept { return cells_.data() + index(i, 0); }
+    [[nodiscard]] const std::uint8_t *row(int i) const noexcept { return cells_.data() + index(i, 0); }
+
+    /**
+     * @brief Access a cell by coordinates.
+     *
+     * @param i Row index
+     * @param j Column index
+     * @return Reference to the cell
+     */
+    [[nodiscard]] std::uint8_t &at(int i, int j) noexcept { return cells_[index(i, j)]; }
+    [[nodiscard]] std::uint8_t at(int i, int j) const noexcept { return cells_[index(i, j)]; }
+
+private:
+    int rows_ = 0;                    ///< Rows excluding the border
+    int cols_ = 0;                    ///< Columns excluding the border
+    int stride_ = 2;                  ///< Columns including the border
+    std::vector<std::uint8_t> cells_; ///< Row-major cells with the border
+};
+
+} // namespace aoc
@@ -0,0 +1,460 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <iterator>
+#include <charconv>
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AOC_HAS_MMAP 1
+#else
+#include <fstream>
+#define AOC_HAS_MMAP 0
+#endif
+
+namespace aoc
+{
+
+/**
+ * @class MappedFile
+ * @brief Read-only view of a whole input file.
+ *
+ * The file is opened once and memory-mapped; there is no separate existence
+ * or size check before opening. All views handed out by the parsing helpers
+ * below point into this mapping, so the MappedFile must outlive them.
+ * Moving a MappedFile keeps the mapped address, so views remain valid.
+ * Platforms without mmap fall back to reading the file into one buffer.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Map a file into memory.
+     *
+     * @param file_path Path to the input file
+     * @throws std::runtime_error if the file doesn't exist or cannot be mapped
+     */
+    explicit MappedFile(const std::filesystem::path &file_path)
+    {
+#if AOC_HAS_MMAP
+        const int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno == ENOENT)
+            {
+                throw std::runtime_error("File does not exist: " + file_path.string());
+            }
+            throw std::runtime_error("Cannot open file: " + file_path.string());
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Cannot open file: " + file_path.string());
+        }
+
+        size_ = static_cast<std::size_t>(info.st_size);
+        if (size_ > 0)
+        {
+            void *mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("Cannot map file: " + file_path.string());
+            }
+            ::madvise(mapping, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const char *>(mapping);
+        }
+        ::close(fd);
+#else
+        std::ifstream file(file_path, std::ios::binary);
+        if (!file.is_open())
+        {
+            throw std::runtime_error(std::filesystem::exists(file_path) ? "Cannot open file: " + file_path.string()
+                                                                        : "File does not exist: " + file_path.string());
+        }
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+#if !AOC_HAS_MMAP
+          ,
+          buffer_(std::move(other.buffer_))
+#endif
+    {
+    }
+
+    MappedFile &operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#if !AOC_HAS_MMAP
+            buffer_ = std::move(other.buffer_);
+#endif
+        }
+        return *this;
+    }
+
+    ~MappedFile() { release(); }
+
+    /**
+     * @brief Get the whole file contents.
+     * @return View over the mapped bytes
+     */
+    [[nodiscard]] std::string_view view() const noexcept { return {data_, size_}; }
+
+    /**
+     * @brief Get the file size in bytes.
+     * @return Number of mapped bytes
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+private:
+    void release() noexcept
+    {
+#if AOC_HAS_MMAP
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char *>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const char *data_ = nullptr; ///< Start of the mapped bytes
+    std::size_t size_ = 0;       ///< Number of mapped bytes
+#if !AOC_HAS_MMAP
+    std::vector<char> buffer_; ///< Fallback storage when mmap is unavailable
+#endif
+};
+
+/**
+ * @class SplitRange
+ * @brief Lazy range of string_view pieces separated by a single character.
+ *
+ * With @c skip_trailing set, a final empty piece after the last delimiter is
+ * not produced, which matches how std::getline treats a trailing newline.
+ * Carriage returns are stripped from the end of every piece when
+ * @c strip_cr is set.
+ */
+class SplitRange
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view *;
+        using reference = std::string_view;
+
+        constexpr iterator() noexcept = default;
+        constexpr iterator(const SplitRange *range, std::string_view text) noexcept
+            : range_(range), rest_(text), more_(!(range->skip_trailing_ && text.empty()))
+        {
+            advance();
+        }
+
+        [[nodiscard]] constexpr std::string_view operator*() const noexcept { return current_; }
+        [[nodiscard]] constexpr pointer operator->() const noexcept { return &current_; }
+
+        constexpr iterator &operator++() noexcept
+        {
+            advance();
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            advance();
+            return copy;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator &other) const noexcept
+        {
+            return range_ == other.range_ && current_.data() == other.current_.data() && more_ == other.more_;
+        }
+
+    private:
+        constexpr void advance() noexcept
+        {
+            if (!more_)
+            {
+                *this = iterator();
+                return;
+            }
+
+            const auto pos = rest_.find(range_->delimiter_);
+            if (pos == std::string_view::npos)
+            {
+                current_ = rest_;
+                rest_ = {};
+                more_ = false;
+            }
+            else
+            {
+                current_ = rest_.substr(0, pos);
+                rest_.remove_prefix(pos + 1);
+                more_ = !(range_->skip_trailing_ && rest_.empty());
+            }
+
+            if (range_->strip_cr_ && !current_.empty() && current_.back() == '\r')
+            {
+                current_.remove_suffix(1);
+            }
+        }
+
+        const SplitRange *range_ = nullptr; ///< Owning range, null for the end iterator
+        std::string_view current_{};        ///< Piece the iterator points at
+        std::string_view rest_{};           ///< Text after the current piece
+        bool more_ = false;                 ///< Whether another piece follows
+    };
+
+    constexpr SplitRange(std::string_view text, char delimiter, bool skip_trailing, bool strip_cr) noexcept
+        : text_(text), delimiter_(delimiter), skip_trailing_(skip_trailing), strip_cr_(strip_cr)
+    {
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(this, text_); }
+    [[nodiscard]] constexpr iterator end() const noexcept { return iterator(); }
+
+private:
+    std::string_view text_; ///< Text being split
+    char delimiter_;        ///< Piece separator
+    bool skip_trailing_;    ///< Drop an empty piece after the final delimiter
+    bool strip_cr_;         ///< Strip a trailing '\r' from every piece
+};
+
+/**
+ * @brief Iterate over the lines of a text without copying.
+ *
+ * @param text Text to split (usually MappedFile::view())
+ * @return Range of lines without their '\n' (and '\r') terminators
+ */
+[[nodiscard]] constexpr SplitRange lines(std::string_view text) noexcept
+{
+    return SplitRange(text, '\n', true, true);
+}
+
+/**
+ * @brief Iterate over delimiter-separated fields without copying.
+ *
+ * @param text Text to split
+ * @param delimiter Field separator
+ * @return Range of fields, including empty ones
+ */
+[[nodiscard]] constexpr SplitRange split(std::string_view text, char delimiter) noexcept
+{
+    return SplitRange(text, delimiter, false, false);
+}
+
+/**
+ * @class InputLines
+ * @brief A mapped input file together with views of all of its lines.
+ *
+ * Behaves like a read-only std::vector<std::string_view>; the views stay
+ * valid for as long as the InputLines object (or anything it is moved into)
+ * is alive.
+ */
+class InputLines
+{
+public:
+    /**
+     * @brief Map a file and index its lines.
+     *
+     * @param file_path Path to the input file
+     * @param skip_empty Whether to drop empty lines
+     * @throws std::runtime_error if the file doesn't exist or cannot be mapped
+     */
+    explicit InputLines(const std::filesystem::path &file_path, bool skip_empty = false) : file_(file_path)
+    {
+        for (const auto line : lines(file_.view()))
+        {
+            if (!skip_empty || !line.empty())
+            {
+                lines_.push_back(line);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return lines_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return lines_.empty(); }
+    [[nodiscard]] std::string_view operator[](std::size_t index) const noexcept { return lines_[index]; }
+    [[nodiscard]] auto begin() const noexcept { return lines_.begin(); }
+    [[nodiscard]] auto end() const noexcept { return lines_.end(); }
+
+private:
+    MappedFile file_;                    ///< Backing storage of every line
+    std::vector<std::string_view> lines_; ///< Line views into file_
+};
+
+/**
+ * @brief Check whether a character is blank (space, tab or line break).
+ * @param c Character to check
+ * @return True for ' ', '\t', '\r' and '\n'
+ */
+[[nodiscard]] constexpr bool is_blank(char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/**
+ * @brief Remove leading and trailing blanks from a view.
+ *
+ * @param text Text to trim
+ * @return Trimmed view into the same storage
+ */
+[[nodiscard]] constexpr std::string_view trim(std::string_view text) noexcept
+{
+    while (!text.empty() && is_blank(text.front()))
+    {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && is_blank(text.back()))
+    {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+/**
+ * @brief Collect the blank-separated words of a text.
+ *
+ * @param text Text to split
+ * @return Views of every non-empty word, in order
+ */
+[[nodiscard]] inline std::vector<std::string_view> words(std::string_view text)
+{
+    std::vector<std::string_view> result;
+    while (true)
+    {
+        while (!text.empty() && is_blank(text.front()))
+        {
+            text.remove_prefix(1);
+        }
+        if (text.empty())
+        {
+            break;
+        }
+
+        std::size_t len = 0;
+        while (len < text.size() && !is_blank(text[len]))
+        {
+            ++len;
+        }
+        result.push_back(text.substr(0, len));
+        text.remove_prefix(len);
+    }
+    return result;
+}
+
+/**
+ * @brief Parse an integer at the front of a view and advance past it.
+ *
+ * Leading blanks are skipped. On failure @p text and @p value are left untouched.
+ *
+ * @param text Cursor into the text, advanced past the number on success
+ * @param value Receives the parsed number
+ * @return True if a number was parsed
+ */
+template <typename T>
+[[nodiscard]] constexpr bool consume_int(std::string_view &text, T &value) noexcept
+{
+    static_assert(std::is_integral_v<T>, "consume_int requires an integral type");
+
+    std::string_view rest = text;
+    while (!rest.empty() && is_blank(rest.front()))
+    {
+        rest.remove_prefix(1);
+    }
+
+    T parsed{};
+    const auto [ptr, ec] = std::from_chars(rest.data(), rest.data() + rest.size(), parsed);
+    if (ec != std::errc{})
+    {
+        return false;
+    }
+
+    value = parsed;
+    text = rest.substr(static_cast<std::size_t>(ptr - rest.data()));
+    return true;
+}
+
+/**
+ * @brief Consume an expected character at the front of a view.
+ *
+ * Leading blanks are skipped.
+ *
+ * @param text Cursor into the text, advanced past the character on success
+ * @param expected Character that must come next
+ * @return True if the character was present
+ */
+[[nodiscard]] constexpr bool consume_char(std::string_view &text, char expected) noexcept
+{
+    std::string_view rest = text;
+    while (!rest.empty() && is_blank(rest.front()))
+    {
+        rest.remove_prefix(1);
+    }
+    if (rest.empty() || rest.front() != expected)
+    {
+        return false;
+    }
+    text = rest.substr(1);
+    return true;
+}
+
+/**
+ * @brief Parse a whole view as one integer.
+ *
+ * Surrounding blanks are ignored; anything else around the number is an error.
+ *
+ * @param text Text holding the number
+ * @return Parsed number
+ * @throws std::runtime_error if the text is not a valid number or out of range
+ */
+template <typename T>
+[[nodiscard]] constexpr T parse_int(std::string_view text)
+{
+    static_assert(std::is_integral_v<T>, "parse_int requires an integral type");
+
+    const auto trimmed = trim(text);
+    T value{};
+    const auto [ptr, ec] = std::from_chars(trimmed.data(), trimmed.data() + trimmed.size(), value);
+    if (ec == std::errc::result_out_of_range)
+    {
+        throw std::runtime_error("Number out of range: " + std::string(text));
+    }
+    if (ec != std::errc{} || ptr != trimmed.data() + trimmed.size())
+    {
+        throw std::runtime_error("Invalid number format: " + std::string(text));
+    }
+    return value;
+}
+
+} // namespace aoc
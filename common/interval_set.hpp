@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "binary_io.hpp"
+
+namespace aoc
+{
+
+/**
+ * @class IntervalSet
+ * @brief Immutable union of closed integer intervals for fast membership tests.
+ *
+ * The intervals are sorted and merged once (overlapping and adjacent ones
+ * become one), then kept as two contiguous arrays of starts and ends. A
+ * single lookup is a binary search over the starts, O(log R); a batch of
+ * sorted queries is answered with one merge pass, O(R + Q).
+ *
+ * @tparam T Integer type of the interval bounds
+ */
+template <typename T>
+class IntervalSet
+{
+public:
+    /// Create an empty set
+    IntervalSet() = default;
+
+    /**
+     * @brief Build the set from any sequence of intervals.
+     *
+     * @param intervals Elements with inclusive `start` and `end` members; empty intervals are ignored
+     */
+    template <typename Intervals>
+    explicit IntervalSet(const Intervals &intervals)
+    {
+        std::vector<std::pair<T, T>> sorted;
+        for (const auto &interval : intervals)
+        {
+            if (interval.start <= interval.end)
+            {
+                sorted.emplace_back(interval.start, interval.end);
+            }
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        starts_.reserve(sorted.size());
+        ends_.reserve(sorted.size());
+        for (const auto &[start, end] : sorted)
+        {
+            // Merge when the interval overlaps or touches the previous one
+            if (!ends_.empty() && (ends_.back() == std::numeric_limits<T>::max() || start <= ends_.back() + 1))
+            {
+                ends_.back() = std::max(ends_.back(), end);
+            }
+            else
+            {
+                starts_.push_back(start);
+                ends_.push_back(end);
+            }
+        }
+    }
+
+    /**
+     * @brief Check whether a value lies in any interval.
+     *
+     * @param value Value to test
+     * @return True if some interval contains the value
+     */
+    [[nodiscard]] bool contains(T value) const noexcept
+    {
+        const auto it = std::upper_bound(starts_.begin(), starts_.end(), value);
+        if (it == starts_.begin())
+        {
+            return false;
+        }
+        return value <= ends_[static_cast<std::size_t>(it - starts_.begin()) - 1];
+    }
+
+    /**
+     * @brief Count how many values of a batch lie in the set.
+     *
+     * Sorted batches are answered with a single merge pass over the
+     * intervals; anything else falls back to one binary search per value.
+     *
+     * @param first Start of the batch
+     * @param last End of the batch
+     * @return Number of values contained in the set, duplicates counted each time
+     */
+    template <typename It>
+    [[nodiscard]] std::size_t count_contained(It first, It last) const
+    {
+        if (!std::is_sorted(first, last))
+        {
+            return static_cast<std::size_t>(std::count_if(first, last, [this](T value)
+                                                          { return contains(value); }));
+        }
+
+        std::size_t count = 0;
+        std::size_t interval = 0;
+        for (; first != last; ++first)
+        {
+            const T value = *first;
+            while (interval < ends_.size() && ends_[interval] < value)
+            {
+                ++interval;
+            }
+            if (interval == ends_.size())
+            {
+                break;
+            }
+            if (starts_[interval] <= value)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Count the values covered by the set.
+     * @return Sum of the merged interval lengths
+     */
+    [[nodiscard]] T cardinality() const noexcept
+    {
+        T total = 0;
+        for (std::size_t i = 0; i < starts_.size(); ++i)
+        {
+            total += ends_[i] - starts_[i] + 1;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Get the number of merged intervals.
+     * @return Interval count
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return starts_.size(); }
+
+    /**
+     * @brief Get the merged interval starts in ascending order.
+     * @return View of the starts
+     */
+    [[nodiscard]] std::span<const T> starts() const noexcept { return starts_; }
+
+    /**
+     * @brief Get the merged interval ends, matching starts().
+     * @return View of the inclusive ends
+     */
+    [[nodiscard]] std::span<const T> ends() const noexcept { return ends_; }
+
+    /**
+     * @brief Serialize the merged intervals, e.g. for the parse cache.
+     *
+     * @param writer Destination
+     * @param set Set to store
+     */
+    friend void save(BinaryWriter &writer, const IntervalSet &set)
+    {
+        writer.write_vector(set.starts_);
+        writer.write_vector(set.ends_);
+    }
+
+    /**
+     * @brief Deserialize merged intervals written by save().
+     *
+     * @param reader Source
+     * @param set Receives the intervals
+     * @throws std::runtime_error if the data is truncated or inconsistent
+     */
+    friend void load(BinaryReader &reader, IntervalSet &set)
+    {
+        set.starts_ = reader.read_vector<T>();
+        set.ends_ = reader.read_vector<T>();
+        if (set.starts_.size() != set.ends_.size())
+        {
+            throw std::runtime_error("Inconsistent interval data");
+        }
+    }
+
+private:
+    std::vector<T> starts_; ///< Interval starts, strictly increasing
+    std::vector<T> ends_;   ///< Inclusive interval ends, strictly increasing
+};
+
+} // namespace aoc
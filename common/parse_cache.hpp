@@ -0,0 +1,241 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include <unistd.h>
+
+#include "binary_io.hpp"
+#include "input.hpp"
+
+namespace aoc::parse_cache
+{
+
+/// First bytes of every cache file, "AOCB" in little-endian order
+inline constexpr std::uint32_t kMagic = 0x42434F41;
+
+/// Version of the header layout below
+inline constexpr std::uint32_t kVersion = 1;
+
+/**
+ * @struct Header
+ * @brief Start of a cache file, followed by the serialized value.
+ */
+struct Header
+{
+    std::uint32_t magic;    ///< kMagic
+    std::uint32_t version;  ///< kVersion
+    std::uint32_t schema;   ///< Layout of the value, chosen by the caller
+    std::uint32_t reserved; ///< Zero
+    std::uint64_t hash;     ///< content_hash() of the text input
+    std::uint64_t size;     ///< Bytes of serialized value after the header
+};
+
+/**
+ * @brief Hash the contents of an input file.
+ *
+ * Eight bytes are mixed per step, so hashing is far cheaper than parsing.
+ *
+ * @param text File contents
+ * @return 64-bit hash
+ */
+[[nodiscard]] inline std::uint64_t content_hash(std::string_view text) noexcept
+{
+    constexpr std::uint64_t kMultiplier = 0x9E3779B97F4A7C15ULL;
+    std::uint64_t hash = text.size() * kMultiplier;
+    const auto mix = [&](std::uint64_t word)
+    {
+        hash = (hash ^ word) * kMultiplier;
+        hash ^= hash >> 29;
+    };
+
+    std::size_t i = 0;
+    for (; i + 8 <= text.size(); i += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, text.data() + i, 8);
+        mix(word);
+    }
+    std::uint64_t tail = 0;
+    std::memcpy(&tail, text.data() + i, text.size() - i);
+    mix(tail);
+    return hash;
+}
+
+/**
+ * @brief Access the process-wide switch of the cache.
+ * @return The switch, off by default
+ */
+[[nodiscard]] inline std::atomic<bool> &enabled_flag() noexcept
+{
+    static std::atomic<bool> enabled = false;
+    return enabled;
+}
+
+/**
+ * @brief Turn the cache on or off for every later read.
+ * @param on Whether reads should use and write cache files
+ */
+inline void enable(bool on) noexcept { enabled_flag().store(on, std::memory_order_relaxed); }
+
+/**
+ * @brief Check whether the cache is on.
+ * @return True after enable(true)
+ */
+[[nodiscard]] inline bool enabled() noexcept { return enabled_flag().load(std::memory_order_relaxed); }
+
+/**
+ * @brief Get the cache file of an input.
+ *
+ * @param file_path Text input
+ * @return The same path with ".aocbin" appended
+ */
+[[nodiscard]] inline std::filesystem::path cache_path(const std::filesystem::path &file_path)
+{
+    return std::filesystem::path(file_path).concat(".aocbin");
+}
+
+/**
+ * @brief Get a fresh name to write a cache file under before renaming it.
+ *
+ * @param file_path Cache file
+ * @return The path with the process id and a per-process sequence number appended
+ */
+[[nodiscard]] inline std::filesystem::path temporary_path(const std::filesystem::path &file_path)
+{
+    static std::atomic<unsigned long long> writes = 0;
+    const auto sequence = writes.fetch_add(1, std::memory_order_relaxed);
+    return std::filesystem::path(file_path).concat("." + std::to_string(::getpid()) + "." + std::to_string(sequence) + ".tmp");
+}
+
+/**
+ * @brief Load a value from a cache file if it matches the input.
+ *
+ * @param file_path Cache file
+ * @param schema Expected value layout
+ * @param hash Hash of the current input contents
+ * @return The value, or nothing if the file is missing, stale or corrupt
+ */
+template <typename T>
+[[nodiscard]] std::optional<T> try_load(const std::filesystem::path &file_path, std::uint32_t schema, std::uint64_t hash)
+{
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(file_path, error))
+    {
+        return std::nullopt;
+    }
+
+    try
+    {
+        const MappedFile file(file_path);
+        BinaryReader reader(file.view());
+        const auto header = reader.read<Header>();
+        if (header.magic != kMagic || header.version != kVersion || header.schema != schema || header.hash != hash ||
+            header.size != reader.remaining())
+        {
+            return std::nullopt;
+        }
+
+        T value{};
+        load(reader, value);
+        if (reader.remaining() != 0)
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+    catch (const std::exception &)
+    {
+        return std::nullopt;
+    }
+}
+
+/**
+ * @brief Write a value to a cache file, best effort.
+ *
+ * The file is written under a temporary name unique to this process and
+ * call, then renamed into place, so concurrent writers of the same cache
+ * never share a file and a reader never sees a partial one. Failures are
+ * ignored apart from removing the temporary file: the input is then
+ * simply parsed again next time.
+ *
+ * @param file_path Cache file
+ * @param schema Value layout
+ * @param hash Hash of the input contents
+ * @param value Value to store
+ */
+template <typename T>
+void try_store(const std::filesystem::path &file_path, std::uint32_t schema, std::uint64_t hash, const T &value)
+{
+    BinaryWriter payload;
+    save(payload, value);
+
+    BinaryWriter writer;
+    writer.write(Header{kMagic, kVersion, schema, 0, hash, payload.bytes().size()});
+
+    const auto partial = temporary_path(file_path);
+    {
+        std::ofstream file(partial, std::ios::binary);
+        file.write(writer.bytes().data(), static_cast<std::streamsize>(writer.bytes().size()));
+        file.write(payload.bytes().data(), static_cast<std::streamsize>(payload.bytes().size()));
+        if (!file)
+        {
+            std::error_code error;
+            std::filesystem::remove(partial, error);
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(partial, file_path, error);
+    if (error)
+    {
+        std::filesystem::remove(partial, error);
+    }
+}
+
+/**
+ * @brief Parse an input, going through its binary cache when the cache is on.
+ *
+ * With the cache off this is just parse(file_path). With it on, the input
+ * is hashed and a cache file next to it with the same hash and schema is
+ * loaded instead of parsing; otherwise the input is parsed and the cache
+ * file is (re)written. The value type needs `save(BinaryWriter &, const T &)`
+ * and `load(BinaryReader &, T &)` functions found by argument-dependent
+ * lookup.
+ *
+ * @param file_path Text input
+ * @param schema Layout id of T; change it whenever save() changes
+ * @param parse Callable parsing the text input into a T
+ * @return Parsed value
+ * @throws Whatever parse throws, e.g. std::runtime_error if the input cannot be read
+ */
+template <typename T, typename Parse>
+[[nodiscard]] T load_or_parse(const std::filesystem::path &file_path, std::uint32_t schema, Parse &&parse)
+{
+    if (!enabled())
+    {
+        return parse(file_path);
+    }
+
+    const std::uint64_t hash = content_hash(MappedFile(file_path).view());
+    const auto cache = cache_path(file_path);
+    if (auto value = try_load<T>(cache, schema, hash))
+    {
+        return std::move(*value);
+    }
+
+    T value = parse(file_path);
+    try_store(cache, schema, hash, value);
+    return value;
+}
+
+} // namespace aoc::parse_cache
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <future>
+#include <utility>
+
+namespace aoc
+{
+
+/**
+ * @brief Solve both parts of a puzzle on one parsed input.
+ *
+ * Part 1 runs on its own thread while Part 2 runs on the caller's, so
+ * independent parts overlap instead of running back to back. Both solvers
+ * only read the input, which is parsed once by the caller.
+ *
+ * @param input Parsed puzzle input shared by both parts
+ * @param part1 Callable computing the Part 1 answer from the input
+ * @param part2 Callable computing the Part 2 answer from the input
+ * @return Pair of the Part 1 and Part 2 answers
+ * @throws Any exception raised by either solver
+ */
+template <typename Input, typename Part1, typename Part2>
+[[nodiscard]] auto solve_parts(const Input &input, Part1 &&part1, Part2 &&part2)
+{
+    auto first = std::async(std::launch::async, [&input, &part1]
+                            { return part1(input); });
+    auto second = part2(input);
+    return std::pair{first.get(), std::move(second)};
+}
+
+} // namespace aoc
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aoc::stats
+{
+
+/**
+ * @brief Whether search instrumentation is compiled in.
+ *
+ * Build with -DAOC_STATS to enable it. Without the flag every type below is
+ * empty and every call is an inline no-op, so instrumented solvers compile
+ * to the same code as uninstrumented ones.
+ */
+#if defined(AOC_STATS)
+inline constexpr bool kEnabled = true;
+#else
+inline constexpr bool kEnabled = false;
+#endif
+
+/**
+ * @enum Counter
+ * @brief Quantities a solver can report.
+ */
+enum class Counter : unsigned char
+{
+    NodesExpanded,     ///< Search nodes visited
+    PrunedByCost,      ///< Branches cut because they cannot beat the best cost
+    PrunedByNegative,  ///< Branches cut because a remaining amount went negative
+    PrunedByArea,      ///< Branches cut because the pieces no longer fit the free area
+    MaxDepth,          ///< Deepest search level reached (maximum, not a sum)
+    MemoHits,          ///< Subproblems answered from a memo
+    MemoMisses,        ///< Subproblems computed and stored
+    Nanoseconds,       ///< Time spent, summed over every thread that worked on the item
+};
+
+/// Number of Counter values
+inline constexpr std::size_t kCounterCount = 8;
+
+/// JSON names of the counters, indexed by Counter
+inline constexpr std::array<std::string_view, kCounterCount> kCounterNames = {
+    "nodes_expanded", "pruned_by_cost", "pruned_by_negative", "pruned_by_area",
+    "max_depth", "memo_hits", "memo_misses", "time_ns"};
+
+/**
+ * @class Counters
+ * @brief Counters of one unit of work, safe to update from several threads.
+ *
+ * Updates are relaxed atomic adds; MaxDepth keeps the largest value seen.
+ */
+class Counters
+{
+public:
+#if defined(AOC_STATS)
+    Counters() = default;
+    Counters(const Counters &other) noexcept { merge(other); }
+
+    /**
+     * @brief Add to a counter.
+     *
+     * @param counter Counter to update
+     * @param amount Value to add
+     */
+    void add(Counter counter, long long amount = 1) noexcept
+    {
+        values_[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record a search depth, keeping the maximum.
+     * @param depth Current depth
+     */
+    void depth(long long depth) noexcept
+    {
+        auto &slot = values_[static_cast<std::size_t>(Counter::MaxDepth)];
+        long long seen = slot.load(std::memory_order_relaxed);
+        while (depth > seen && !slot.compare_exchange_weak(seen, depth, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * @brief Read a counter.
+     *
+     * @param counter Counter to read
+     * @return Current value
+     */
+    [[nodiscard]] long long get(Counter counter) const noexcept
+    {
+        return values_[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add another set of counters to this one.
+     * @param other Counters to fold in; MaxDepth is combined by maximum
+     */
+    void merge(const Counters &other) noexcept
+    {
+        for (std::size_t i = 0; i < kCounterCount; ++i)
+        {
+            const long long value = other.values_[i].load(std::memory_order_relaxed);
+            if (static_cast<Counter>(i) == Counter::MaxDepth)
+            {
+                depth(value);
+            }
+            else
+            {
+                values_[i].fetch_add(value, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    std::array<std::atomic<long long>, kCounterCount> values_{}; ///< Value per Counter
+#else
+    void add(Counter, long long = 1) noexcept {}
+    void depth(long long) noexcept {}
+    [[nodiscard]] long long get(Counter) const noexcept { return 0; }
+    void merge(const Counters &) noexcept {}
+#endif
+};
+
+/**
+ * @class Stopwatch
+ * @brief Measures elapsed time into a Counters object when it goes out of scope.
+ */
+class Stopwatch
+{
+public:
+#if defined(AOC_STATS)
+    /**
+     * @brief Start timing.
+     * @param counters Receives the elapsed Nanoseconds
+     */
+    explicit Stopwatch(Counters &counters) noexcept
+        : counters_(counters), start_(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~Stopwatch()
+    {
+        counters_.add(Counter::Nanoseconds,
+                      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count());
+    }
+
+private:
+    Counters &counters_;                               ///< Target of the measurement
+    std::chrono::steady_clock::time_point start_;      ///< Construction time
+#else
+    explicit Stopwatch(Counters &) noexcept {}
+#endif
+
+    Stopwatch(const Stopwatch &) = delete;
+    Stopwatch &operator=(const Stopwatch &) = delete;
+};
+
+#if defined(AOC_STATS)
+namespace detail
+{
+
+/// One recorded unit of work
+struct Item
+{
+    std::string label;                            ///< e.g. "machine 17"
+    std::array<long long, kCounterCount> values;  ///< Counter values
+};
+
+/// Process-wide record of the current solver call
+struct Registry
+{
+    std::mutex mutex;         ///< Guards the members below
+    std::vector<Item> items;  ///< Recorded units of work, in recording order
+};
+
+[[nodiscard]] inline Registry &registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+} // namespace detail
+#endif
+
+/**
+ * @brief Record the counters of one unit of work, such as a machine or a region.
+ *
+ * @param kind Kind of unit, e.g. "machine"
+ * @param index 1-based position of the unit in the input
+ * @param counters Its counters
+ */
+inline void record([[maybe_unused]] std::string_view kind, [[maybe_unused]] std::size_t index,
+                   [[maybe_unused]] const Counters &counters)
+{
+#if defined(AOC_STATS)
+    detail::Item item{std::string(kind) + " " + std::to_string(index), {}};
+    for (std::size_t i = 0; i < kCounterCount; ++i)
+    {
+        item.values[i] = counters.get(static_cast<Counter>(i));
+    }
+    auto &registry = detail::registry();
+    const std::lock_guard lock(registry.mutex);
+    registry.items.push_back(std::move(item));
+#endif
+}
+
+/**
+ * @brief Forget everything recorded so far, before a new solver call.
+ */
+inline void reset()
+{
+#if defined(AOC_STATS)
+    auto &registry = detail::registry();
+    const std::lock_guard lock(registry.mutex);
+    registry.items.clear();
+#endif
+}
+
+/**
+ * @brief Render the recorded stats as a JSON object.
+ *
+ * "totals" sums every counter over all items (MaxDepth takes the maximum);
+ * "items" lists the units of work, slowest first. Zero counters are omitted.
+ *
+ * @return JSON object text, "{}" when nothing was recorded or stats are compiled out
+ */
+[[nodiscard]] inline std::string to_json()
+{
+#if defined(AOC_STATS)
+    auto &registry = detail::registry();
+    const std::lock_guard lock(registry.mutex);
+    if (registry.items.empty())
+    {
+        return "{}";
+    }
+
+    const auto fields = [](const std::array<long long, kCounterCount> &values)
+    {
+        std::string text;
+        for (std::size_t i = 0; i < kCounterCount; ++i)
+        {
+            if (values[i] != 0)
+            {
+                text += (text.empty() ? "\"" : ", \"") + std::string(kCounterNames[i]) + "\": " + std::to_string(values[i]);
+            }
+        }
+        return text;
+    };
+
+    std::array<long long, kCounterCount> totals{};
+    for (const auto &item : registry.items)
+    {
+        for (std::size_t i = 0; i < kCounterCount; ++i)
+        {
+            totals[i] = static_cast<Counter>(i) == Counter::MaxDepth ? std::max(totals[i], item.values[i])
+                                                                     : totals[i] + item.values[i];
+        }
+    }
+
+    std::vector<const detail::Item *> order;
+    for (const auto &item : registry.items)
+    {
+        order.push_back(&item);
+    }
+    constexpr auto kTime = static_cast<std::size_t>(Counter::Nanoseconds);
+    std::stable_sort(order.begin(), order.end(), [](const detail::Item *a, const detail::Item *b)
+                     { return a->values[kTime] > b->values[kTime]; });
+
+    std::string json = "{\"totals\": {" + fields(totals) + "}, \"items\": [";
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        const std::string rest = fields(order[i]->values);
+        json += (i == 0 ? "" : ", ") + std::string("{\"label\": \"") + order[i]->label + "\"" +
+                (rest.empty() ? "" : ", " + rest) + "}";
+    }
+    return json + "]}";
+#else
+    return "{}";
+#endif
+}
+
+} // namespace aoc::stats
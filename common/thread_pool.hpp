@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace aoc
+{
+
+/**
+ * @class ThreadBudget
+ * @brief Caps the worker count of pools started by solvers on the current thread.
+ *
+ * Solvers that parallelise internally size their pools with threads(),
+ * which is one per hardware thread by default. A scheduler running many
+ * solvers at once, such as the runner's batch mode, installs a budget
+ * around each call so that the nested pools together stay within the
+ * machine instead of multiplying it. Budgets nest; the innermost one wins.
+ */
+class ThreadBudget
+{
+public:
+    /**
+     * @brief Limit pools started on this thread until the budget goes out of scope.
+     *
+     * @param threads Most workers a solver may start, at least 1
+     */
+    explicit ThreadBudget(unsigned threads) noexcept : previous_(std::exchange(limit(), std::max(1U, threads))) {}
+
+    ThreadBudget(const ThreadBudget &) = delete;
+    ThreadBudget &operator=(const ThreadBudget &) = delete;
+
+    ~ThreadBudget() { limit() = previous_; }
+
+    /**
+     * @brief Get the number of workers a solver should start.
+     * @return The innermost budget on this thread, or one per hardware thread without one
+     */
+    [[nodiscard]] static unsigned threads() noexcept
+    {
+        const unsigned budget = limit();
+        return budget != 0 ? budget : std::max(1U, std::thread::hardware_concurrency());
+    }
+
+private:
+    [[nodiscard]] static unsigned &limit() noexcept
+    {
+        thread_local unsigned budget = 0;
+        return budget;
+    }
+
+    unsigned previous_; ///< Budget to restore, 0 for none
+};
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads with one task deque each and work stealing.
+ *
+ * A task submitted from inside a worker goes to that worker's own deque and
+ * is run newest first, so recursive searches that split their top levels
+ * keep working on the subtree they just created. Tasks submitted from other
+ * threads go to a shared queue and start in submission order. A worker with
+ * nothing of its own takes from the shared queue, then steals the oldest
+ * task of another deque, which is the largest piece of work left.
+ *
+ * wait() blocks until every queue is empty and no task is running, so a
+ * caller never has to block inside a task and nested submission cannot
+ * deadlock. The first exception thrown by a task is kept and rethrown from
+ * wait().
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Start the worker threads.
+     *
+     * @param threads Number of workers; 0 picks ThreadBudget::threads()
+     */
+    explicit ThreadPool(unsigned threads = 0)
+    {
+        if (threads == 0)
+        {
+            threads = ThreadBudget::threads();
+        }
+        queues_.reserve(threads);
+        for (unsigned i = 0; i < threads; ++i)
+        {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+        workers_.reserve(threads);
+        for (unsigned i = 0; i < threads; ++i)
+        {
+            workers_.emplace_back([this, i]
+                                  { work(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            const std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Queue a task for execution on any worker.
+     *
+     * @param task Callable to run; safe to call from inside another task
+     */
+    void submit(std::function<void()> task)
+    {
+        const Worker &caller = current();
+        Queue &queue = caller.pool == this ? *queues_[caller.index] : shared_;
+        {
+            // Count first, so a worker taking the task at once never sees pending_ below its true value
+            const std::lock_guard lock(mutex_);
+            ++queued_;
+            ++pending_;
+        }
+        {
+            const std::lock_guard lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        wake_.notify_one();
+    }
+
+    /**
+     * @brief Block until every submitted task, including nested ones, has finished.
+     *
+     * @throws Any exception raised by a task; remaining tasks still run to completion
+     */
+    void wait()
+    {
+        std::unique_lock lock(mutex_);
+        idle_.wait(lock, [this]
+                   { return pending_ == 0; });
+        if (error_)
+        {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    }
+
+    /**
+     * @brief Get the number of worker threads.
+     * @return Worker count
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return workers_.size(); }
+
+private:
+    /// Task deque of one worker
+    struct Queue
+    {
+        std::mutex mutex;                        ///< Guards tasks
+        std::deque<std::function<void()>> tasks; ///< Owner pops the back, thieves the front
+    };
+
+    /// Identifies the pool and deque of the calling worker thread
+    struct Worker
+    {
+        const ThreadPool *pool = nullptr; ///< Pool the thread works for, nullptr outside workers
+        std::size_t index = 0;            ///< Its deque
+    };
+
+    /**
+     * @brief Get the worker identity of the calling thread.
+     * @return Identity, set on every worker thread and empty elsewhere
+     */
+    [[nodiscard]] static Worker &current() noexcept
+    {
+        thread_local Worker worker;
+        return worker;
+    }
+
+    /**
+     * @brief Take the newest or oldest task of a deque.
+     *
+     * @param queue Deque to take from
+     * @param newest Take from the back instead of the front
+     * @param task Receives the task
+     * @return False if the deque was empty
+     */
+    bool take_from(Queue &queue, bool newest, std::function<void()> &task)
+    {
+        {
+            const std::lock_guard lock(queue.mutex);
+            if (queue.tasks.empty())
+            {
+                return false;
+            }
+            if (newest)
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+        }
+        const std::lock_guard lock(mutex_);
+        --queued_;
+        return true;
+    }
+
+    /**
+     * @brief Take a task: own deque first, then the shared queue, then steal.
+     *
+     * @param self Index of the calling worker
+     * @param task Receives the task
+     * @return False if every queue was empty
+     */
+    bool take(std::size_t self, std::function<void()> &task)
+    {
+        if (take_from(*queues_[self], true, task) || take_from(shared_, false, task))
+        {
+            return true;
+        }
+        for (std::size_t k = 1; k < queues_.size(); ++k)
+        {
+            if (take_from(*queues_[(self + k) % queues_.size()], false, task))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(std::size_t self)
+    {
+        current() = {this, self};
+        while (true)
+        {
+            std::function<void()> task;
+            if (!take(self, task))
+            {
+                std::unique_lock lock(mutex_);
+                wake_.wait(lock, [this]
+                           { return stopping_ || queued_ > 0; });
+                if (queued_ == 0)
+                {
+                    return; // stopping and drained
+                }
+                continue;
+            }
+
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                const std::lock_guard error_lock(mutex_);
+                if (!error_)
+                {
+                    error_ = std::current_exception();
+                }
+            }
+
+            const std::lock_guard lock(mutex_);
+            if (--pending_ == 0)
+            {
+                idle_.notify_all();
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_; ///< One deque per worker
+    Queue shared_;                               ///< Tasks submitted from outside the workers, oldest first
+    std::vector<std::thread> workers_;           ///< Worker threads
+    std::mutex mutex_;                           ///< Guards every member below
+    std::condition_variable wake_;               ///< Signalled when work arrives or on shutdown
+    std::condition_variable idle_;               ///< Signalled when pending_ drops to zero
+    std::size_t queued_ = 0;                     ///< Tasks sitting in a deque
+    std::size_t pending_ = 0;                    ///< Queued plus running tasks
+    std::exception_ptr error_;                   ///< First exception thrown by a task
+    bool stopping_ = false;                      ///< Set by the destructor
+};
+
+} // namespace aoc
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace aoc
+{
+
+/**
+ * @class UnionFind
+ * @brief Disjoint-set forest with union by size and path halving.
+ *
+ * Parent links and set sizes share one array: a non-negative entry is the
+ * parent of an element, a negative entry marks a root and stores the negated
+ * size of its set. The number of sets is kept up to date on every union, so
+ * callers can stop as soon as everything is connected.
+ */
+class UnionFind
+{
+public:
+    /**
+     * @brief Create n singleton sets.
+     *
+     * @param n Number of elements, labelled 0..n-1
+     */
+    explicit UnionFind(int n) : entries_(static_cast<std::size_t>(n), -1), components_(n) {}
+
+    /**
+     * @brief Find the representative of an element's set.
+     *
+     * Halves the path on the way up, pointing every other node at its
+     * grandparent, without recursion.
+     *
+     * @param x Element to look up
+     * @return Root of the set containing x
+     */
+    [[nodiscard]] int find(int x) noexcept
+    {
+        while (entries_[x] >= 0)
+        {
+            const int parent = entries_[x];
+            if (entries_[parent] >= 0)
+            {
+                entries_[x] = entries_[parent];
+            }
+            x = entries_[x]; // skip the grandparent's child, so only every other node is relinked
+        }
+        return x;
+    }
+
+    /**
+     * @brief Merge the sets containing two elements.
+     *
+     * @param x First element
+     * @param y Second element
+     * @return True if the sets were distinct and have been merged
+     */
+    bool unite(int x, int y) noexcept
+    {
+        x = find(x);
+        y = find(y);
+        if (x == y)
+        {
+            return false;
+        }
+
+        // Entries of roots are negative sizes, so the larger set has the smaller entry
+        if (entries_[x] > entries_[y])
+        {
+            std::swap(x, y);
+        }
+        entries_[x] += entries_[y];
+        entries_[y] = x;
+        --components_;
+        return true;
+    }
+
+    /**
+     * @brief Check whether two elements are in the same set.
+     *
+     * @param x First element
+     * @param y Second element
+     * @return True if x and y share a root
+     */
+    [[nodiscard]] bool connected(int x, int y) noexcept { return find(x) == find(y); }
+
+    /**
+     * @brief Get the size of the set containing an element.
+     *
+     * @param x Element to look up
+     * @return Number of elements in its set
+     */
+    [[nodiscard]] int size_of(int x) noexcept { return -entries_[find(x)]; }
+
+    /**
+     * @brief Get the current number of disjoint sets.
+     * @return Number of sets, 1 once everything is connected
+     */
+    [[nodiscard]] int components() const noexcept { return components_; }
+
+    /**
+     * @brief Get the number of elements.
+     * @return Number of elements the structure was created with
+     */
+    [[nodiscard]] int size() const noexcept { return static_cast<int>(entries_.size()); }
+
+    /**
+     * @brief Get the sizes of the k largest sets.
+     *
+     * Scans the roots once and keeps a bounded min-heap of k sizes, so no
+     * per-set container is built.
+     *
+     * @param k Number of sizes wanted
+     * @return Up to k set sizes in descending order
+     */
+    [[nodiscard]] std::vector<int> largest_sizes(std::size_t k) const
+    {
+        std::vector<int> heap;
+        heap.reserve(k);
+        if (k == 0)
+        {
+            return heap;
+        }
+
+        for (const int entry : entries_)
+        {
+            if (entry >= 0)
+            {
+                continue;
+            }
+
+            const int set_size = -entry;
+            if (heap.size() < k)
+            {
+                heap.push_back(set_size);
+                std::push_heap(heap.begin(), heap.end(), std::greater<>{});
+            }
+            else if (set_size > heap.front())
+            {
+                std::pop_heap(heap.begin(), heap.end(), std::greater<>{});
+                heap.back() = set_size;
+                std::push_heap(heap.begin(), heap.end(), std::greater<>{});
+            }
+        }
+
+        std::sort_heap(heap.begin(), heap.end(), std::greater<>{});
+        return heap;
+    }
+
+private:
+    std::vector<int> entries_; ///< Parent index, or negated set size for roots
+    int components_;           ///< Number of disjoint sets
+};
+
+} // namespace aoc
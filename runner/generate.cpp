@@ -0,0 +1,120 @@
+#include "generate.hpp"
+
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Main entry point of the input generator.
+ *
+ * Usage: generate [--seed N] [--output FILE] YYYY.D SIZE
+ *        generate --list
+ *
+ * Writes a synthetic input for one puzzle to standard output or a file.
+ * The meaning of SIZE depends on the puzzle, see --list.
+ *
+ * @return 0 on success, 1 if generation fails, 2 on bad usage
+ */
+int main(int argc, char **argv)
+{
+    using namespace aoc::generate;
+
+    const auto to_number = [](std::string_view text, auto &value)
+    {
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc{} || ptr != text.data() + text.size())
+        {
+            throw std::invalid_argument("Invalid number: " + std::string(text));
+        }
+    };
+
+    std::uint64_t seed = 1;
+    std::string output;
+    std::vector<std::string_view> positional;
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg(argv[i]);
+            if (arg == "--list")
+            {
+                for (const auto &generator : all_generators())
+                {
+                    std::cout << generator.year << '.' << generator.day << "  size = " << generator.parameter
+                              << " (at least " << generator.min_size << ")\n";
+                }
+                return 0;
+            }
+            if ((arg == "--seed" || arg == "--output") && i + 1 >= argc)
+            {
+                throw std::invalid_argument("Missing value for " + std::string(arg));
+            }
+            if (arg == "--seed")
+            {
+                to_number(argv[++i], seed);
+            }
+            else if (arg == "--output")
+            {
+                output = argv[++i];
+            }
+            else if (arg.starts_with("--"))
+            {
+                throw std::invalid_argument("Unknown option: " + std::string(arg));
+            }
+            else
+            {
+                positional.push_back(arg);
+            }
+        }
+        if (positional.size() != 2)
+        {
+            throw std::invalid_argument("Usage: generate [--seed N] [--output FILE] YYYY.D SIZE");
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+
+    try
+    {
+        const std::string_view puzzle = positional[0];
+        const auto dot = puzzle.find('.');
+        int year = 0;
+        int day = 0;
+        long long size = 0;
+        to_number(puzzle.substr(0, dot), year);
+        to_number(dot == std::string_view::npos ? std::string_view{} : puzzle.substr(dot + 1), day);
+        to_number(positional[1], size);
+
+        const Generator *generator = find_generator(year, day);
+        if (generator == nullptr)
+        {
+            throw std::invalid_argument("No generator for " + std::string(puzzle));
+        }
+
+        if (output.empty())
+        {
+            write_input(*generator, std::cout, size, seed);
+        }
+        else
+        {
+            std::ofstream file(output);
+            if (!file.is_open())
+            {
+                throw std::runtime_error("Cannot open file: " + output);
+            }
+            write_input(*generator, file, size, seed);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,502 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aoc::generate
+{
+
+using Rng = std::mt19937_64;
+
+/**
+ * @brief Draw a uniformly distributed integer.
+ *
+ * @param rng Random engine
+ * @param lo Smallest value
+ * @param hi Largest value
+ * @return Value in [lo, hi]
+ */
+[[nodiscard]] inline long long uniform(Rng &rng, long long lo, long long hi)
+{
+    return std::uniform_int_distribution<long long>(lo, hi)(rng);
+}
+
+/**
+ * @brief Draw a biased coin.
+ *
+ * @param rng Random engine
+ * @param p Probability of true
+ * @return True with probability p
+ */
+[[nodiscard]] inline bool chance(Rng &rng, double p)
+{
+    return std::bernoulli_distribution(p)(rng);
+}
+
+/**
+ * @brief 2024 Day 1: `size` pairs of five-digit location ids.
+ */
+inline void write_2024_day1(std::ostream &out, long long size, Rng &rng)
+{
+    for (long long i = 0; i < size; i++)
+    {
+        out << uniform(rng, 10000, 99999) << "   " << uniform(rng, 10000, 99999) << '\n';
+    }
+}
+
+/**
+ * @brief 2025 Day 1: `size` dial rotations of 1-999 clicks.
+ */
+inline void write_2025_day1(std::ostream &out, long long size, Rng &rng)
+{
+    for (long long i = 0; i < size; i++)
+    {
+        out << (chance(rng, 0.5) ? 'L' : 'R') << uniform(rng, 1, 999) << '\n';
+    }
+}
+
+/**
+ * @brief 2025 Day 2: 16 id ranges, each `size` ids wide.
+ *
+ * Repeated-pattern ids of d digits made of r copies of a block lie about
+ * 10^(d - d / r) apart, so each range gets a digit count whose spacing is
+ * roughly a tenth of its width: every range then holds several invalid
+ * ids at any size. Even ranges use doubled blocks (both parts), odd ones
+ * tripled blocks (mostly Part 2). Ids have at most 14 digits, so both sums
+ * fit in 64 bits up to a width of 10^10.
+ */
+inline void write_2025_day2(std::ostream &out, long long size, Rng &rng)
+{
+    constexpr int kRanges = 16;
+    constexpr int kMaxDigits = 14;
+    int width_digits = 0;
+    for (long long rest = size; rest > 0; rest /= 10)
+    {
+        width_digits++;
+    }
+    const int spacing = std::max(1, width_digits - 1);
+
+    for (int i = 0; i < kRanges; i++)
+    {
+        const int copies = i % 2 == 0 ? 2 : 3;
+        const int block = std::min(std::max(1, spacing / (copies - 1)), kMaxDigits / copies);
+        const int digits = block * copies;
+
+        long long lo = 1;
+        for (int k = 1; k < digits; k++)
+        {
+            lo *= 10;
+        }
+        const long long hi = lo * 10 - 1;
+        const long long start = uniform(rng, lo, std::max(lo, hi - size + 1));
+        out << (i == 0 ? "" : ",") << start << '-' << start + size - 1;
+    }
+    out << '\n';
+}
+
+/**
+ * @brief 2025 Day 3: `size` battery banks of 100 digits.
+ */
+inline void write_2025_day3(std::ostream &out, long long size, Rng &rng)
+{
+    std::string bank(100, '1');
+    for (long long i = 0; i < size; i++)
+    {
+        for (char &c : bank)
+        {
+            c = static_cast<char>('1' + uniform(rng, 0, 8));
+        }
+        out << bank << '\n';
+    }
+}
+
+/**
+ * @brief 2025 Day 4: a `size` x `size` grid, 60% paper rolls.
+ */
+inline void write_2025_day4(std::ostream &out, long long size, Rng &rng)
+{
+    std::string row(static_cast<std::size_t>(size), '.');
+    for (long long i = 0; i < size; i++)
+    {
+        for (char &c : row)
+        {
+            c = chance(rng, 0.6) ? '@' : '.';
+        }
+        out << row << '\n';
+    }
+}
+
+/**
+ * @brief 2025 Day 5: `size` fresh-id ranges followed by `size` ids.
+ */
+inline void write_2025_day5(std::ostream &out, long long size, Rng &rng)
+{
+    constexpr long long kMaxId = 500'000'000'000'000;
+    for (long long i = 0; i < size; i++)
+    {
+        const long long start = uniform(rng, 1, kMaxId);
+        out << start << '-' << start + uniform(rng, 0, 1'000'000'000'000) << '\n';
+    }
+    out << '\n';
+    for (long long i = 0; i < size; i++)
+    {
+        out << uniform(rng, 1, kMaxId) << '\n';
+    }
+}
+
+/**
+ * @brief 2025 Day 6: a worksheet of `size` problems with four numbers each.
+ *
+ * Every problem is 1-4 columns wide, one of its numbers spans the full
+ * width, and the others are placed at random offsets inside it.
+ */
+inline void write_2025_day6(std::ostream &out, long long size, Rng &rng)
+{
+    constexpr int kNumbers = 4;
+    std::array<std::string, kNumbers + 1> rows;
+    for (long long p = 0; p < size; p++)
+    {
+        const int width = static_cast<int>(uniform(rng, 1, 4));
+        const int widest = static_cast<int>(uniform(rng, 0, kNumbers - 1));
+        for (int r = 0; r < kNumbers; r++)
+        {
+            const int digits = r == widest ? width : static_cast<int>(uniform(rng, 1, width));
+            const int offset = static_cast<int>(uniform(rng, 0, width - digits));
+            std::string cell(width, ' ');
+            for (int d = 0; d < digits; d++)
+            {
+                cell[offset + d] = static_cast<char>(d == 0 ? '1' + uniform(rng, 0, 8) : '0' + uniform(rng, 0, 9));
+            }
+            rows[r] += (p == 0 ? "" : " ") + cell;
+        }
+        rows[kNumbers] += (p == 0 ? "" : " ") + std::string(1, chance(rng, 0.5) ? '+' : '*') + std::string(width - 1, ' ');
+    }
+    for (const auto &row : rows)
+    {
+        out << row << '\n';
+    }
+}
+
+/**
+ * @brief 2025 Day 7: a `size` x `size` manifold, splitters on every other row.
+ */
+inline void write_2025_day7(std::ostream &out, long long size, Rng &rng)
+{
+    std::string row(static_cast<std::size_t>(size), '.');
+    row[row.size() / 2] = 'S';
+    out << row << '\n';
+    for (long long i = 1; i < size; i++)
+    {
+        for (char &c : row)
+        {
+            c = i % 2 == 0 && chance(rng, 0.25) ? '^' : '.';
+        }
+        out << row << '\n';
+    }
+}
+
+/**
+ * @brief 2025 Day 8: `size` junction boxes in a 100000^3 cube.
+ */
+inline void write_2025_day8(std::ostream &out, long long size, Rng &rng)
+{
+    for (long long i = 0; i < size; i++)
+    {
+        out << uniform(rng, 0, 99999) << ',' << uniform(rng, 0, 99999) << ',' << uniform(rng, 0, 99999) << '\n';
+    }
+}
+
+/**
+ * @brief 2025 Day 9: a rectilinear polygon with `size` vertices (rounded down to even).
+ *
+ * A flat bottom edge closes a staircase of random column heights, which is
+ * simple and axis-aligned by construction.
+ */
+inline void write_2025_day9(std::ostream &out, long long size, Rng &rng)
+{
+    const long long columns = size / 2 - 1;
+    const long long span = std::max<long long>(100'000, 2 * (columns + 1));
+    const long long step = span / (columns + 1);
+
+    std::vector<long long> xs(columns + 1);
+    for (long long i = 0; i <= columns; i++)
+    {
+        xs[i] = i * step + uniform(rng, 0, step - 1);
+    }
+
+    long long height = 0;
+    out << xs[0] << ",0\n";
+    for (long long i = 0; i < columns; i++)
+    {
+        long long next = height;
+        while (next == height)
+        {
+            next = uniform(rng, 1, 100'000);
+        }
+        height = next;
+        out << xs[i] << ',' << height << '\n'
+            << xs[i + 1] << ',' << height << '\n';
+    }
+    out << xs[columns] << ",0\n";
+}
+
+/**
+ * @brief 2025 Day 10: `size` machines built from a known press vector, so every one is solvable.
+ */
+inline void write_2025_day10(std::ostream &out, long long size, Rng &rng)
+{
+    for (long long m = 0; m < size; m++)
+    {
+        const int lights = static_cast<int>(uniform(rng, 4, 10));
+        const int buttons = static_cast<int>(uniform(rng, lights - 2, lights + 3));
+
+        std::vector<int> joltage(lights, 0);
+        std::vector<bool> target(lights, false);
+        std::string wiring;
+        for (int b = 0; b < buttons; b++)
+        {
+            const long long presses = uniform(rng, 0, 30);
+            std::vector<int> wired;
+            for (int l = 0; l < lights; l++)
+            {
+                if (chance(rng, 0.4))
+                {
+                    wired.push_back(l);
+                }
+            }
+            if (wired.empty())
+            {
+                wired.push_back(static_cast<int>(uniform(rng, 0, lights - 1)));
+            }
+
+            wiring += " (";
+            for (size_t i = 0; i < wired.size(); i++)
+            {
+                wiring += (i == 0 ? "" : ",") + std::to_string(wired[i]);
+                joltage[wired[i]] += static_cast<int>(presses);
+                if (presses % 2 == 1)
+                {
+                    target[wired[i]] = !target[wired[i]];
+                }
+            }
+            wiring += ')';
+        }
+
+        out << '[';
+        for (const bool on : target)
+        {
+            out << (on ? '#' : '.');
+        }
+        out << ']' << wiring << " {";
+        for (int l = 0; l < lights; l++)
+        {
+            out << (l == 0 ? "" : ",") << joltage[l];
+        }
+        out << "}\n";
+    }
+}
+
+/**
+ * @brief 2025 Day 11: a layered DAG 39 layers deep and `size` devices wide.
+ *
+ * Every device feeds one to three devices up to three layers ahead, or
+ * "out" past the last layer, so out-degrees and path lengths vary. "you"
+ * and "svr" start the first layer and "dac" and "fft" sit in layers 13 and
+ * 26. The first device of every layer always feeds the first device of the
+ * next, so svr reaches out through dac and fft. A path has at most 39 hops
+ * of at most 3 choices, so path counts stay below 3^39 < 2^63.
+ */
+inline void write_2025_day11(std::ostream &out, long long size, Rng &rng)
+{
+    constexpr long long kLayers = 39;
+    constexpr long long kMaxDegree = 3;
+    constexpr long long kMaxJump = 3;
+    const long long devices = kLayers * size;
+
+    int letters = 4; // longer than every fixed name, so no collisions
+    for (long long capacity = 26 * 26 * 26 * 26; capacity < devices; capacity *= 26)
+    {
+        letters++;
+    }
+
+    const auto name = [&](long long layer, long long index) -> std::string
+    {
+        if (layer >= kLayers)
+            return "out";
+        if (layer == 0 && index == 0)
+            return "you";
+        if (layer == 0 && index == 1)
+            return "svr";
+        if (layer == 13 && index == 0)
+            return "dac";
+        if (layer == 26 && index == 0)
+            return "fft";
+
+        std::string text(letters, 'a');
+        for (long long id = layer * size + index, i = letters - 1; i >= 0; id /= 26, i--)
+        {
+            text[i] = static_cast<char>('a' + id % 26);
+        }
+        return text;
+    };
+
+    std::vector<std::string> targets;
+    for (long long layer = 0; layer < kLayers; layer++)
+    {
+        for (long long index = 0; index < size; index++)
+        {
+            targets.clear();
+            if (index == 0 || (layer == 0 && index == 1))
+            {
+                targets.push_back(name(layer + 1, 0)); // backbone through dac and fft
+            }
+            const long long degree = uniform(rng, 1, kMaxDegree);
+            for (long long attempt = 0; static_cast<long long>(targets.size()) < degree && attempt < 4 * kMaxDegree; attempt++)
+            {
+                std::string target = name(layer + uniform(rng, 1, kMaxJump), uniform(rng, 0, size - 1));
+                if (std::find(targets.begin(), targets.end(), target) == targets.end())
+                {
+                    targets.push_back(std::move(target));
+                }
+            }
+
+            out << name(layer, index) << ':';
+            for (const auto &target : targets)
+            {
+                out << ' ' << target;
+            }
+            out << '\n';
+        }
+    }
+}
+
+/**
+ * @brief 2025 Day 12: the six 3x3 present shapes and `size` regions.
+ *
+ * Like the puzzle input, every region falls clearly on one side: either
+ * each present gets its own 3x3 tile or the presents cover more cells than
+ * the region has, so this scales the parser and prefilters rather than the
+ * exponential packing search.
+ */
+inline void write_2025_day12(std::ostream &out, long long size, Rng &rng)
+{
+    out << "0:\n###\n###\n#..\n\n"
+        << "1:\n###\n##.\n#..\n\n"
+        << "2:\n###\n..#\n###\n\n"
+        << "3:\n..#\n.##\n##.\n\n"
+        << "4:\n###\n.#.\n###\n\n"
+        << "5:\n###\n##.\n.##\n\n";
+
+    constexpr int kShapes = 6;
+    for (long long r = 0; r < size; r++)
+    {
+        const long long width = uniform(rng, 30, 50);
+        const long long height = uniform(rng, 30, 50);
+        const long long tiles = (width / 3) * (height / 3);
+        // Every present covers at least 5 cells, so more than width * height / 5 never fit
+        const long long presents = chance(rng, 0.5) ? uniform(rng, tiles / 2, tiles)
+                                                    : uniform(rng, width * height / 5 + 1, width * height / 4);
+
+        std::array<long long, kShapes> counts{};
+        for (long long p = 0; p < presents; p++)
+        {
+            counts[uniform(rng, 0, kShapes - 1)]++;
+        }
+        out << width << 'x' << height << ':';
+        for (const long long count : counts)
+        {
+            out << ' ' << count;
+        }
+        out << '\n';
+    }
+}
+
+/**
+ * @struct Generator
+ * @brief Writes synthetic inputs of a chosen size for one puzzle.
+ */
+struct Generator
+{
+    int year;                                          ///< Edition year
+    int day;                                           ///< Puzzle day
+    std::string_view parameter;                        ///< What `size` counts, e.g. "points"
+    long long min_size;                                ///< Smallest accepted size
+    void (*write)(std::ostream &, long long, Rng &);   ///< Writes one input
+    int revision;                                      ///< Bumped whenever write changes its output
+};
+
+/**
+ * @brief List every available generator.
+ *
+ * @return Generators in edition/day order
+ */
+[[nodiscard]] inline const std::vector<Generator> &all_generators()
+{
+    static const std::vector<Generator> generators = {
+        {2024, 1, "pairs", 1, write_2024_day1, 1},
+        {2025, 1, "rotations", 1, write_2025_day1, 1},
+        {2025, 2, "range width", 1, write_2025_day2, 2},
+        {2025, 3, "banks", 1, write_2025_day3, 1},
+        {2025, 4, "grid side", 1, write_2025_day4, 1},
+        {2025, 5, "ranges and ids", 1, write_2025_day5, 1},
+        {2025, 6, "problems", 1, write_2025_day6, 1},
+        {2025, 7, "grid side", 3, write_2025_day7, 1},
+        {2025, 8, "points", 50, write_2025_day8, 1},
+        {2025, 9, "vertices", 4, write_2025_day9, 1},
+        {2025, 10, "machines", 1, write_2025_day10, 1},
+        {2025, 11, "layer width", 2, write_2025_day11, 2},
+        {2025, 12, "regions", 1, write_2025_day12, 1},
+    };
+    return generators;
+}
+
+/**
+ * @brief Look up the generator of a puzzle.
+ *
+ * @param year Edition year
+ * @param day Puzzle day
+ * @return Generator, or nullptr if the puzzle has none
+ */
+[[nodiscard]] inline const Generator *find_generator(int year, int day)
+{
+    for (const auto &generator : all_generators())
+    {
+        if (generator.year == year && generator.day == day)
+        {
+            return &generator;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Write one synthetic input.
+ *
+ * The same generator, size and seed always produce the same input.
+ *
+ * @param generator Puzzle generator
+ * @param out Output stream
+ * @param size Scale of the input, see Generator::parameter
+ * @param seed Random seed
+ * @throws std::invalid_argument if the size is below the generator's minimum
+ */
+inline void write_input(const Generator &generator, std::ostream &out, long long size, std::uint64_t seed)
+{
+    if (size < generator.min_size)
+    {
+        throw std::invalid_argument("Size for " + std::to_string(generator.year) + " Day " +
+                                    std::to_string(generator.day) + " must be at least " +
+                                    std::to_string(generator.min_size));
+    }
+    Rng rng(seed);
+    generator.write(out, size, rng);
+}
+
+} // namespace aoc::generate
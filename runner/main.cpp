@@ -0,0 +1,1396 @@
+#define AOC_RUNNER
+
+#include "../2024/Day1/main.cpp"
+#include "../2025/Day1/main.cpp"
+#include "../2025/Day2/main.cpp"
+#include "../2025/Day3/main.cpp"
+#include "../2025/Day4/main.cpp"
+#include "../2025/Day5/main.cpp"
+#include "../2025/Day6/main.cpp"
+#include "../2025/Day7/main.cpp"
+#include "../2025/Day8/main.cpp"
+#include "../2025/Day9/main.cpp"
+#include "../2025/Day10/main.cpp"
+#include "../2025/Day11/main.cpp"
+#include "../2025/Day12/main.cpp"
+
+#include "../common/parse_cache.hpp"
+#include "../common/stats.hpp"
+#include "generate.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <deque>
+#include <tuple>
+#include <functional>
+#include <algorithm>
+#include <chrono>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aoc::runner
+{
+
+using Clock = std::chrono::steady_clock;
+using Nanoseconds = std::chrono::nanoseconds;
+
+/**
+ * @struct Sample
+ * @brief Timing and answer of a single parse + solve iteration.
+ */
+struct Sample
+{
+    Nanoseconds parse; ///< Time spent reading and parsing the input
+    Nanoseconds solve; ///< Time spent in the solver on the parsed input
+    std::string answer; ///< Answer rendered as a decimal string
+};
+
+/**
+ * @struct Solution
+ * @brief A registered puzzle part that the runner can execute.
+ */
+struct Solution
+{
+    int year;                                                  ///< Edition year
+    int day;                                                   ///< Puzzle day
+    int part;                                                  ///< Puzzle part (1 or 2)
+    bool slow;                                                 ///< Skipped unless selected explicitly
+    std::string_view parser;                                   ///< Name of the parse step
+    std::function<Sample(const std::filesystem::path &)> run; ///< Parse and solve once
+    std::function<std::shared_ptr<const void>(const std::filesystem::path &)> parse; ///< Parse only, for solve
+    std::function<std::string(const void *)> solve; ///< Solve input returned by parse of any part with the same parser
+};
+
+/**
+ * @brief Render a solver result as a decimal string.
+ *
+ * @param value Integral result or a type providing to_string()
+ * @return Decimal representation of the value
+ */
+template <typename T>
+[[nodiscard]] std::string to_answer(const T &value)
+{
+    if constexpr (std::is_integral_v<T>)
+    {
+        return std::to_string(value);
+    }
+    else
+    {
+        return value.to_string();
+    }
+}
+
+/**
+ * @brief Build a Solution from separate parse and solve callables.
+ *
+ * The parse step is timed on its own so that the reported solve time
+ * covers only the work done on the already parsed input. The same two
+ * steps are also exposed separately with the parsed input type-erased,
+ * so batch mode can parse a file once and solve every part of its day on
+ * the shared result.
+ *
+ * @param year Edition year
+ * @param day Puzzle day
+ * @param part Puzzle part
+ * @param slow Whether the part is excluded from default runs
+ * @param parser Name of the parse step
+ * @param parse Callable turning an input path into parsed data
+ * @param solve Callable turning parsed data into an answer
+ * @return Registered solution
+ */
+template <typename Parse, typename Solve>
+[[nodiscard]] Solution make_solution(int year, int day, int part, bool slow, std::string_view parser, Parse parse,
+                                     Solve solve)
+{
+    using Input = std::invoke_result_t<Parse, const std::filesystem::path &>;
+    return Solution{year, day, part, slow, parser,
+                    [parse, solve](const std::filesystem::path &file_path)
+                    {
+                        const auto t0 = Clock::now();
+                        auto input = parse(file_path);
+                        const auto t1 = Clock::now();
+                        const auto result = solve(std::move(input));
+                        const auto t2 = Clock::now();
+                        return Sample{t1 - t0, t2 - t1, to_answer(result)};
+                    },
+                    [parse](const std::filesystem::path &file_path) -> std::shared_ptr<const void>
+                    { return std::make_shared<const Input>(parse(file_path)); },
+                    [solve](const void *input)
+                    { return to_answer(solve(*static_cast<const Input *>(input))); }};
+}
+
+#define AOC_SOLUTION(YEAR, DAY, PART, PARSER, SLOW)                                                   \
+    make_solution(                                                                                    \
+        YEAR, DAY, PART, SLOW, #PARSER,                                                               \
+        [](const std::filesystem::path &file_path) { return aoc##YEAR::day##DAY::PARSER(file_path); }, \
+        [](auto &&input)                                                                              \
+        { return aoc##YEAR::day##DAY::advent_of_code_##YEAR##_day##DAY##_part##PART(std::forward<decltype(input)>(input)); })
+
+/**
+ * @brief List every puzzle part known to the runner.
+ *
+ * @return Registered solutions in edition/day/part order
+ */
+[[nodiscard]] std::vector<Solution> all_solutions()
+{
+    return {
+        AOC_SOLUTION(2024, 1, 1, read_input, false),
+        AOC_SOLUTION(2024, 1, 2, read_input, false),
+        AOC_SOLUTION(2025, 1, 1, map_input, false),
+        AOC_SOLUTION(2025, 1, 2, map_input, false),
+        AOC_SOLUTION(2025, 2, 1, read_input, false),
+        AOC_SOLUTION(2025, 2, 2, read_input, false),
+        AOC_SOLUTION(2025, 3, 1, read_input, false),
+        AOC_SOLUTION(2025, 3, 2, read_input, false),
+        AOC_SOLUTION(2025, 4, 1, read_input, false),
+        AOC_SOLUTION(2025, 4, 2, read_input, false),
+        AOC_SOLUTION(2025, 5, 1, read_input, false),
+        AOC_SOLUTION(2025, 5, 2, read_input, false),
+        AOC_SOLUTION(2025, 6, 1, read_input, false),
+        AOC_SOLUTION(2025, 6, 2, read_input, false),
+        AOC_SOLUTION(2025, 7, 1, read_input, false),
+        AOC_SOLUTION(2025, 7, 2, read_input, false),
+        AOC_SOLUTION(2025, 8, 1, read_input, false),
+        AOC_SOLUTION(2025, 8, 2, read_input, false),
+        AOC_SOLUTION(2025, 9, 1, read_input, false),
+        AOC_SOLUTION(2025, 9, 2, read_input, false),
+        AOC_SOLUTION(2025, 10, 1, read_input, false),
+        AOC_SOLUTION(2025, 10, 2, read_input, false),
+        AOC_SOLUTION(2025, 11, 1, read_input, false),
+        AOC_SOLUTION(2025, 11, 2, read_input, false),
+        AOC_SOLUTION(2025, 12, 1, read_input, false),
+    };
+}
+
+#undef AOC_SOLUTION
+
+/**
+ * @brief Build the input path of a puzzle part relative to the repository root.
+ *
+ * @param root Repository root directory
+ * @param solution Puzzle part
+ * @return Path to the part's input.txt
+ */
+[[nodiscard]] std::filesystem::path input_path(const std::filesystem::path &root, const Solution &solution)
+{
+    return root / std::to_string(solution.year) / ("Day" + std::to_string(solution.day)) / "input.txt";
+}
+
+/**
+ * @brief Read the expected answers listed in README.md.
+ *
+ * Walks the "## YYYY Edition" / "### Day N" headings and picks up the
+ * bolded value of every "silver star" (part 1), "final star" (part 1)
+ * and "gold star" (part 2) line.
+ *
+ * @param readme_path Path to README.md
+ * @return Map from {year, day, part} to the expected answer
+ * @throws std::runtime_error if the file cannot be opened
+ */
+[[nodiscard]] std::map<std::tuple<int, int, int>, std::string> read_expected_answers(const std::filesystem::path &readme_path)
+{
+    std::ifstream file(readme_path);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Cannot open file: " + readme_path.string());
+    }
+
+    const auto leading_int = [](std::string_view text)
+    {
+        int value = 0;
+        std::from_chars(text.data(), text.data() + text.size(), value);
+        return value;
+    };
+
+    std::map<std::tuple<int, int, int>, std::string> expected;
+    int year = 0;
+    int day = 0;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        const std::string_view view(line);
+
+        if (view.starts_with("## "))
+        {
+            year = leading_int(view.substr(3));
+            continue;
+        }
+        if (view.starts_with("### Day "))
+        {
+            day = leading_int(view.substr(8));
+            continue;
+        }
+
+        int part = 0;
+        if (view.find("silver star") != std::string_view::npos || view.find("final star") != std::string_view::npos)
+        {
+            part = 1;
+        }
+        else if (view.find("gold star") != std::string_view::npos)
+        {
+            part = 2;
+        }
+
+        const auto open = view.find("**");
+        const auto close = open == std::string_view::npos ? open : view.find("**", open + 2);
+        if (part != 0 && close != std::string_view::npos)
+        {
+            expected[{year, day, part}] = std::string(view.substr(open + 2, close - open - 2));
+        }
+    }
+
+    return expected;
+}
+
+/**
+ * @struct Options
+ * @brief Command line configuration of the runner.
+ */
+struct Options
+{
+    std::filesystem::path root = ".";  ///< Repository root with YYYY/DayN directories
+    int warmup = 1;                    ///< Untimed iterations before measuring
+    int iterations = 5;                ///< Timed iterations per part
+    std::string format = "text";       ///< Output format: text, json or csv
+    bool include_slow = false;         ///< Run parts marked as slow without selecting them
+    std::vector<std::string> selectors; ///< "YYYY", "YYYY.D" or "YYYY.D.P" filters
+    std::vector<long long> sweep;      ///< Generated input sizes to benchmark instead of input.txt
+    std::uint64_t seed = 1;            ///< Seed of the generated inputs
+    std::filesystem::path sweep_dir = std::filesystem::temp_directory_path() / "aoc_sweep"; ///< Where generated inputs are kept
+    std::filesystem::path batch;       ///< Directory or manifest of inputs to solve instead of benchmarking
+    unsigned threads = 0;              ///< Batch workers, 0 for one per hardware thread
+    bool parse_cache = false;          ///< Load parsed inputs from binary caches next to them
+};
+
+/**
+ * @brief Check whether a solution matches a selector.
+ *
+ * @param solution Puzzle part
+ * @param selector "YYYY", "YYYY.D" or "YYYY.D.P"
+ * @return True if every component present in the selector matches
+ */
+[[nodiscard]] bool matches(const Solution &solution, std::string_view selector)
+{
+    const int ids[] = {solution.year, solution.day, solution.part};
+    for (const int id : ids)
+    {
+        if (selector.empty())
+        {
+            return true;
+        }
+
+        const auto dot = selector.find('.');
+        const auto component = selector.substr(0, dot);
+        int value = 0;
+        const auto [ptr, ec] = std::from_chars(component.data(), component.data() + component.size(), value);
+        if (ec != std::errc{} || ptr != component.data() + component.size())
+        {
+            throw std::invalid_argument("Invalid selector: " + std::string(selector));
+        }
+        if (value != id)
+        {
+            return false;
+        }
+
+        selector = dot == std::string_view::npos ? std::string_view{} : selector.substr(dot + 1);
+    }
+    return selector.empty();
+}
+
+/**
+ * @brief Parse command line arguments.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Parsed options
+ * @throws std::invalid_argument on unknown flags or malformed values
+ */
+[[nodiscard]] Options parse_options(int argc, char **argv)
+{
+    Options options;
+
+    const auto next_value = [&](int &i) -> std::string_view
+    {
+        if (i + 1 >= argc)
+        {
+            throw std::invalid_argument(std::string("Missing value for ") + argv[i]);
+        }
+        return argv[++i];
+    };
+
+    const auto to_count = [](std::string_view text)
+    {
+        int value = 0;
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc{} || ptr != text.data() + text.size() || value < 0)
+        {
+            throw std::invalid_argument("Invalid count: " + std::string(text));
+        }
+        return value;
+    };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+
+        if (arg == "--root")
+        {
+            options.root = next_value(i);
+        }
+        else if (arg == "--warmup")
+        {
+            options.warmup = to_count(next_value(i));
+        }
+        else if (arg == "--iterations")
+        {
+            options.iterations = std::max(1, to_count(next_value(i)));
+        }
+        else if (arg == "--format")
+        {
+            options.format = next_value(i);
+            if (options.format != "text" && options.format != "json" && options.format != "csv")
+            {
+                throw std::invalid_argument("Unknown format: " + options.format);
+            }
+        }
+        else if (arg == "--include-slow")
+        {
+            options.include_slow = true;
+        }
+        else if (arg == "--sweep")
+        {
+            const std::string_view list = next_value(i);
+            for (size_t start = 0; start <= list.size();)
+            {
+                const auto comma = std::min(list.find(',', start), list.size());
+                const auto item = list.substr(start, comma - start);
+                long long size = 0;
+                const auto [ptr, ec] = std::from_chars(item.data(), item.data() + item.size(), size);
+                if (ec != std::errc{} || ptr != item.data() + item.size() || size <= 0)
+                {
+                    throw std::invalid_argument("Invalid sweep size: " + std::string(item));
+                }
+                options.sweep.push_back(size);
+                start = comma + 1;
+            }
+            std::sort(options.sweep.begin(), options.sweep.end());
+            options.sweep.erase(std::unique(options.sweep.begin(), options.sweep.end()), options.sweep.end());
+        }
+        else if (arg == "--seed")
+        {
+            options.seed = static_cast<std::uint64_t>(to_count(next_value(i)));
+        }
+        else if (arg == "--sweep-dir")
+        {
+            options.sweep_dir = next_value(i);
+        }
+        else if (arg == "--batch")
+        {
+            options.batch = next_value(i);
+        }
+        else if (arg == "--threads")
+        {
+            options.threads = static_cast<unsigned>(to_count(next_value(i)));
+        }
+        else if (arg == "--parse-cache")
+        {
+            options.parse_cache = true;
+        }
+        else if (arg.starts_with("--"))
+        {
+            throw std::invalid_argument("Unknown option: " + std::string(arg));
+        }
+        else
+        {
+            options.selectors.emplace_back(arg);
+        }
+    }
+
+    return options;
+}
+
+/**
+ * @struct Summary
+ * @brief Order statistics over a set of timings.
+ */
+struct Summary
+{
+    long long min;    ///< Fastest sample in nanoseconds
+    long long median; ///< Median sample in nanoseconds
+    long long p99;    ///< 99th percentile (nearest rank) in nanoseconds
+};
+
+/**
+ * @brief Compute min/median/p99 of a set of timings.
+ *
+ * @param samples Timings in nanoseconds (reordered in place)
+ * @return Summary statistics
+ */
+[[nodiscard]] Summary summarize(std::vector<long long> &samples)
+{
+    std::sort(samples.begin(), samples.end());
+    const auto n = samples.size();
+    const auto p99_rank = (n * 99 + 99) / 100; // ceil(0.99 * n)
+    return Summary{samples.front(), samples[n / 2], samples[p99_rank - 1]};
+}
+
+/**
+ * @struct Report
+ * @brief Result of benchmarking one puzzle part.
+ */
+struct Report
+{
+    const Solution *solution; ///< Benchmarked part
+    std::string answer;       ///< Answer from the first timed iteration
+    std::string expected;     ///< Answer listed in README.md, empty if unknown
+    std::string status;       ///< "ok", "mismatch", "unknown" or "error"
+    std::string error;        ///< Exception message when status is "error"
+    Summary parse;            ///< Parse timings
+    Summary solve;            ///< Solve timings
+    Summary total;            ///< Parse + solve timings
+    std::string stats;        ///< Search stats JSON of the first timed iteration, empty without AOC_STATS
+};
+
+/**
+ * @brief Run warmup and timed iterations of one puzzle part.
+ *
+ * @param solution Puzzle part to run
+ * @param options Runner configuration
+ * @param file_path Input file to run on
+ * @param expected Expected answer, empty if unknown
+ * @return Benchmark report
+ */
+[[nodiscard]] Report benchmark(const Solution &solution, const Options &options,
+                               const std::filesystem::path &file_path, std::string expected)
+{
+    Report report{&solution, {}, std::move(expected), "unknown", {}, {}, {}, {}, {}};
+
+    try
+    {
+        for (int i = 0; i < options.warmup; ++i)
+        {
+            static_cast<void>(solution.run(file_path));
+        }
+
+        std::vector<long long> parse_ns, solve_ns, total_ns;
+        for (int i = 0; i < options.iterations; ++i)
+        {
+            if (i == 0)
+            {
+                aoc::stats::reset();
+            }
+            auto sample = solution.run(file_path);
+            parse_ns.push_back(sample.parse.count());
+            solve_ns.push_back(sample.solve.count());
+            total_ns.push_back((sample.parse + sample.solve).count());
+            if (i == 0)
+            {
+                report.answer = std::move(sample.answer);
+                if constexpr (aoc::stats::kEnabled)
+                {
+                    report.stats = aoc::stats::to_json();
+                }
+            }
+        }
+
+        report.parse = summarize(parse_ns);
+        report.solve = summarize(solve_ns);
+        report.total = summarize(total_ns);
+
+        if (!report.expected.empty())
+        {
+            report.status = report.answer == report.expected ? "ok" : "mismatch";
+        }
+    }
+    catch (const std::exception &e)
+    {
+        report.status = "error";
+        report.error = e.what();
+    }
+
+    return report;
+}
+
+/**
+ * @brief Escape a string for inclusion in a JSON document.
+ *
+ * Quotes and backslashes are escaped, newlines, carriage returns and tabs
+ * get their short escapes and every other control character becomes
+ * \\u00XX, so exception messages and paths always yield valid JSON.
+ *
+ * @param text Raw text
+ * @return Escaped text without surrounding quotes
+ */
+[[nodiscard]] std::string json_escape(std::string_view text)
+{
+    std::string result;
+    result.reserve(text.size());
+    for (const char c : text)
+    {
+        switch (c)
+        {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\r':
+            result += "\\r";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char code[7];
+                std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(c)));
+                result += code;
+            }
+            else
+            {
+                result += c;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Quote a string as one CSV field.
+ *
+ * The field is wrapped in double quotes with embedded quotes doubled
+ * (RFC 4180), so commas, quotes and line breaks stay inside it.
+ *
+ * @param text Raw text
+ * @return Quoted field
+ */
+[[nodiscard]] std::string csv_field(std::string_view text)
+{
+    std::string result;
+    result.reserve(text.size() + 2);
+    result += '"';
+    for (const char c : text)
+    {
+        if (c == '"')
+        {
+            result += '"';
+        }
+        result += c;
+    }
+    result += '"';
+    return result;
+}
+
+/**
+ * @brief Render a duration for text output.
+ *
+ * @param ns Duration in nanoseconds
+ * @return Microseconds with one decimal, e.g. "12.3us"
+ */
+[[nodiscard]] std::string microseconds(long long ns)
+{
+    return std::to_string(ns / 1000) + "." + std::to_string(ns / 100 % 10) + "us";
+}
+
+/**
+ * @brief Write benchmark reports in the selected format.
+ *
+ * @param out Output stream
+ * @param reports Reports to print
+ * @param options Runner configuration
+ */
+void print_reports(std::ostream &out, const std::vector<Report> &reports, const Options &options)
+{
+    if (options.format == "json")
+    {
+        out << "{\n  \"warmup\": " << options.warmup << ",\n  \"iterations\": " << options.iterations
+            << ",\n  \"results\": [";
+        for (size_t i = 0; i < reports.size(); ++i)
+        {
+            const auto &r = reports[i];
+            const auto summary = [&](const char *name, const Summary &s)
+            {
+                out << "\"" << name << "\": {\"min\": " << s.min << ", \"median\": " << s.median
+                    << ", \"p99\": " << s.p99 << "}";
+            };
+            out << (i == 0 ? "\n" : ",\n") << "    {\"year\": " << r.solution->year << ", \"day\": "
+                << r.solution->day << ", \"part\": " << r.solution->part << ", \"status\": \"" << r.status
+                << "\", \"answer\": \"" << json_escape(r.answer) << "\", \"expected\": \""
+                << json_escape(r.expected) << "\", ";
+            if (r.status == "error")
+            {
+                out << "\"error\": \"" << json_escape(r.error) << "\"}";
+                continue;
+            }
+            out << "\"unit\": \"ns\", ";
+            summary("parse", r.parse);
+            out << ", ";
+            summary("solve", r.solve);
+            out << ", ";
+            summary("total", r.total);
+            if (!r.stats.empty())
+            {
+                out << ", \"stats\": " << r.stats;
+            }
+            out << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+    else if (options.format == "csv")
+    {
+        out << "year,day,part,status,answer,expected,parse_min_ns,parse_median_ns,parse_p99_ns,"
+               "solve_min_ns,solve_median_ns,solve_p99_ns,total_min_ns,total_median_ns,total_p99_ns\n";
+        for (const auto &r : reports)
+        {
+            out << r.solution->year << ',' << r.solution->day << ',' << r.solution->part << ',' << r.status << ','
+                << csv_field(r.answer) << ',' << csv_field(r.expected);
+            for (const auto *s : {&r.parse, &r.solve, &r.total})
+            {
+                out << ',' << s->min << ',' << s->median << ',' << s->p99;
+            }
+            out << '\n';
+        }
+    }
+    else
+    {
+        for (const auto &r : reports)
+        {
+            out << r.solution->year << " Day " << r.solution->day << " Part " << r.solution->part << ": ";
+            if (r.status == "error")
+            {
+                out << "ERROR " << r.error << '\n';
+                continue;
+            }
+            out << r.answer << " [" << r.status << "]"
+                << "  parse " << microseconds(r.parse.median) << "  solve " << microseconds(r.solve.median)
+                << " (min " << microseconds(r.solve.min) << ", p99 " << microseconds(r.solve.p99) << ")\n";
+        }
+    }
+}
+
+/**
+ * @struct SweepReport
+ * @brief Benchmarks of one puzzle part on generated inputs of growing size.
+ */
+struct SweepReport
+{
+    const Solution *solution;                   ///< Benchmarked part
+    const aoc::generate::Generator *generator;  ///< Generator of its inputs
+    std::vector<long long> sizes;               ///< Input sizes, ascending
+    std::vector<Report> points;                 ///< Report per size
+};
+
+/**
+ * @brief Estimate the empirical complexity exponent between two sweep points.
+ *
+ * Fits t = c * n^k through both points, so 1 means linear and 2 quadratic.
+ *
+ * @param n0 Smaller size
+ * @param t0 Median total time at n0
+ * @param n1 Larger size
+ * @param t1 Median total time at n1
+ * @return Exponent k, or NaN if a time is not positive
+ */
+[[nodiscard]] double scaling_exponent(long long n0, long long t0, long long n1, long long t1)
+{
+    if (t0 <= 0 || t1 <= 0)
+    {
+        return std::nan("");
+    }
+    return std::log(static_cast<double>(t1) / t0) / std::log(static_cast<double>(n1) / n0);
+}
+
+/**
+ * @brief Get a generated input, writing it on first use.
+ *
+ * Files are named after the puzzle, size, seed and generator revision, so
+ * both parts of a day and repeated sweeps share them, while a changed
+ * generator never reuses a stale file.
+ *
+ * @param generator Puzzle generator
+ * @param size Input size
+ * @param options Runner configuration with the seed and directory
+ * @return Path to the input file
+ * @throws std::runtime_error if the file cannot be written
+ */
+[[nodiscard]] std::filesystem::path generated_input(const aoc::generate::Generator &generator, long long size,
+                                                    const Options &options)
+{
+    const auto file_path = options.sweep_dir / (std::to_string(generator.year) + "_Day" + std::to_string(generator.day) +
+                                                "_" + std::to_string(size) + "_" + std::to_string(options.seed) + "_r" +
+                                                std::to_string(generator.revision) + ".txt");
+    if (std::filesystem::exists(file_path))
+    {
+        return file_path;
+    }
+
+    std::filesystem::create_directories(options.sweep_dir);
+    const auto partial = std::filesystem::path(file_path).concat(".tmp");
+    {
+        std::ofstream file(partial, std::ios::binary);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Cannot open file: " + partial.string());
+        }
+        aoc::generate::write_input(generator, file, size, options.seed);
+    }
+    std::filesystem::rename(partial, file_path);
+    return file_path;
+}
+
+/**
+ * @brief Benchmark one puzzle part on every sweep size.
+ *
+ * Sizes below the generator's minimum are skipped.
+ *
+ * @param solution Puzzle part
+ * @param generator Generator of its inputs
+ * @param options Runner configuration
+ * @return Sweep report
+ */
+[[nodiscard]] SweepReport sweep(const Solution &solution, const aoc::generate::Generator &generator,
+                                const Options &options)
+{
+    SweepReport report{&solution, &generator, {}, {}};
+    for (const long long size : options.sweep)
+    {
+        if (size < generator.min_size)
+        {
+            continue;
+        }
+        report.sizes.push_back(size);
+        report.points.push_back(benchmark(solution, options, generated_input(generator, size, options), {}));
+    }
+    return report;
+}
+
+/**
+ * @brief Write sweep reports in the selected format.
+ *
+ * Every point after the first carries the scaling exponent of the median
+ * total time relative to the previous point.
+ *
+ * @param out Output stream
+ * @param reports Sweep reports to print
+ * @param options Runner configuration
+ */
+void print_sweeps(std::ostream &out, const std::vector<SweepReport> &reports, const Options &options)
+{
+    const auto exponent = [](const SweepReport &r, size_t i)
+    {
+        return i == 0 ? std::nan("")
+                      : scaling_exponent(r.sizes[i - 1], r.points[i - 1].total.median, r.sizes[i], r.points[i].total.median);
+    };
+    const auto fixed = [](double value)
+    {
+        char text[32];
+        std::snprintf(text, sizeof(text), "%.2f", value);
+        return std::string(text);
+    };
+
+    if (options.format == "json")
+    {
+        out << "{\n  \"warmup\": " << options.warmup << ",\n  \"iterations\": " << options.iterations
+            << ",\n  \"seed\": " << options.seed << ",\n  \"sweeps\": [";
+        for (size_t s = 0; s < reports.size(); ++s)
+        {
+            const auto &r = reports[s];
+            out << (s == 0 ? "\n" : ",\n") << "    {\"year\": " << r.solution->year << ", \"day\": " << r.solution->day
+                << ", \"part\": " << r.solution->part << ", \"parameter\": \"" << r.generator->parameter
+                << "\", \"unit\": \"ns\", \"points\": [";
+            for (size_t i = 0; i < r.points.size(); ++i)
+            {
+                const auto &p = r.points[i];
+                out << (i == 0 ? "" : ", ") << "{\"size\": " << r.sizes[i] << ", \"status\": \"" << p.status << "\"";
+                if (p.status == "error")
+                {
+                    out << ", \"error\": \"" << json_escape(p.error) << "\"}";
+                    continue;
+                }
+                out << ", \"parse\": " << p.parse.median << ", \"solve\": " << p.solve.median
+                    << ", \"total\": " << p.total.median;
+                if (const double k = exponent(r, i); !std::isnan(k))
+                {
+                    out << ", \"exponent\": " << fixed(k);
+                }
+                out << "}";
+            }
+            out << "]}";
+        }
+        out << "\n  ]\n}\n";
+    }
+    else if (options.format == "csv")
+    {
+        out << "year,day,part,parameter,size,status,parse_median_ns,solve_median_ns,total_median_ns,exponent\n";
+        for (const auto &r : reports)
+        {
+            for (size_t i = 0; i < r.points.size(); ++i)
+            {
+                const auto &p = r.points[i];
+                const double k = exponent(r, i);
+                out << r.solution->year << ',' << r.solution->day << ',' << r.solution->part << ','
+                    << r.generator->parameter << ',' << r.sizes[i] << ',' << p.status << ',' << p.parse.median << ','
+                    << p.solve.median << ',' << p.total.median << ',' << (std::isnan(k) ? "" : fixed(k)) << '\n';
+            }
+        }
+    }
+    else
+    {
+        for (const auto &r : reports)
+        {
+            out << r.solution->year << " Day " << r.solution->day << " Part " << r.solution->part << " ("
+                << r.generator->parameter << ")\n";
+            for (size_t i = 0; i < r.points.size(); ++i)
+            {
+                const auto &p = r.points[i];
+                out << "  " << r.sizes[i] << ": ";
+                if (p.status == "error")
+                {
+                    out << "ERROR " << p.error << '\n';
+                    continue;
+                }
+                out << "parse " << microseconds(p.parse.median) << "  solve " << microseconds(p.solve.median)
+                    << "  total " << microseconds(p.total.median);
+                if (const double k = exponent(r, i); !std::isnan(k))
+                {
+                    out << "  n^" << fixed(k);
+                }
+                out << '\n';
+            }
+        }
+    }
+}
+
+/**
+ * @struct BatchJob
+ * @brief One input file to parse once and solve for one or more parts.
+ */
+struct BatchJob
+{
+    std::vector<const Solution *> parts; ///< Parts to solve, all of one day with the same parser
+    std::filesystem::path file;          ///< Input file
+};
+
+/**
+ * @struct BatchResult
+ * @brief Outcome of a finished batch job.
+ */
+struct BatchResult
+{
+    std::string answer;       ///< Answer, empty on error
+    std::string error;        ///< Exception message, empty on success
+    long long parse_ns = 0;   ///< Parse time
+    long long solve_ns = 0;   ///< Solve time
+};
+
+/**
+ * @brief Check whether a part belongs to the heavy lane of batch mode.
+ *
+ * These parts run exponential searches that can take orders of magnitude
+ * longer than any other job, and they are worth running on several
+ * threads of their own.
+ *
+ * @param solution Puzzle part
+ * @return True for 2025 Day 10 Part 2 and 2025 Day 12
+ */
+[[nodiscard]] bool is_heavy(const Solution &solution)
+{
+    return solution.year == 2025 && ((solution.day == 10 && solution.part == 2) || solution.day == 12);
+}
+
+/**
+ * @brief Check whether a batch job has a part in the heavy lane.
+ *
+ * @param job Batch job
+ * @return True if any of its parts is heavy
+ */
+[[nodiscard]] bool has_heavy_part(const BatchJob &job)
+{
+    return std::any_of(job.parts.begin(), job.parts.end(), [](const Solution *part)
+                       { return is_heavy(*part); });
+}
+
+/**
+ * @brief Work out which puzzle an input file in a batch directory belongs to.
+ *
+ * Accepts the repository layout, YYYY/DayD/input*.txt, and flat names that
+ * start with YYYY_DayD_ such as the generated sweep inputs.
+ *
+ * @param file_path Input file
+ * @param year Receives the edition year
+ * @param day Receives the puzzle day
+ * @return False if the path matches neither pattern
+ */
+[[nodiscard]] bool puzzle_of(const std::filesystem::path &file_path, int &year, int &day)
+{
+    const auto parse_pair = [&](std::string_view y, std::string_view d)
+    {
+        const auto [py, ey] = std::from_chars(y.data(), y.data() + y.size(), year);
+        const auto [pd, ed] = std::from_chars(d.data(), d.data() + d.size(), day);
+        return ey == std::errc{} && ed == std::errc{} && py == y.data() + y.size() && pd == d.data() + d.size();
+    };
+
+    const std::string name = file_path.filename().string();
+    if (file_path.extension() != ".txt")
+    {
+        return false;
+    }
+    if (const auto tag = name.find("_Day"); tag != std::string::npos)
+    {
+        const auto end = name.find('_', tag + 4);
+        if (end != std::string::npos && parse_pair(std::string_view(name).substr(0, tag),
+                                                   std::string_view(name).substr(tag + 4, end - tag - 4)))
+        {
+            return true;
+        }
+    }
+
+    const std::string day_dir = file_path.parent_path().filename().string();
+    const std::string year_dir = file_path.parent_path().parent_path().filename().string();
+    return name.starts_with("input") && day_dir.starts_with("Day") &&
+           parse_pair(year_dir, std::string_view(day_dir).substr(3));
+}
+
+/**
+ * @brief Collect the jobs of a batch.
+ *
+ * A directory is scanned recursively and every recognised input is solved
+ * for each selected part of its puzzle. Any other path is read as a
+ * manifest with one "YYYY.D[.P] FILE" entry per line; relative files are
+ * resolved against the manifest's directory, and blank lines and lines
+ * starting with '#' are skipped. Parts of the same day and parser on the
+ * same file are gathered into one job, so the file is parsed only once.
+ *
+ * @param solutions Registered puzzle parts
+ * @param options Runner configuration with the batch source and selectors
+ * @return Jobs in discovery order
+ * @throws std::runtime_error if the manifest cannot be read or names an unknown part
+ */
+[[nodiscard]] std::vector<BatchJob> batch_jobs(const std::vector<Solution> &solutions, const Options &options)
+{
+    const auto selected = [&](const Solution &solution)
+    {
+        return options.selectors.empty() || std::any_of(options.selectors.begin(), options.selectors.end(),
+                                                        [&](const std::string &s)
+                                                        { return matches(solution, s); });
+    };
+
+    std::vector<BatchJob> jobs;
+    std::map<std::tuple<std::filesystem::path, int, int, std::string_view>, std::size_t> job_of;
+    const auto add = [&](const Solution &solution, const std::filesystem::path &file)
+    {
+        const auto [it, inserted] = job_of.try_emplace({file, solution.year, solution.day, solution.parser}, jobs.size());
+        if (inserted)
+        {
+            jobs.push_back({{}, file});
+        }
+        jobs[it->second].parts.push_back(&solution);
+    };
+
+    if (std::filesystem::is_directory(options.batch))
+    {
+        std::vector<std::filesystem::path> files;
+        for (const auto &entry : std::filesystem::recursive_directory_iterator(options.batch))
+        {
+            if (entry.is_regular_file())
+            {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        for (const auto &file : files)
+        {
+            int year = 0;
+            int day = 0;
+            if (!puzzle_of(file, year, day))
+            {
+                continue;
+            }
+            for (const auto &solution : solutions)
+            {
+                if (solution.year == year && solution.day == day && selected(solution))
+                {
+                    add(solution, file);
+                }
+            }
+        }
+        return jobs;
+    }
+
+    std::ifstream manifest(options.batch);
+    if (!manifest.is_open())
+    {
+        throw std::runtime_error("Cannot open file: " + options.batch.string());
+    }
+
+    std::string line;
+    while (std::getline(manifest, line))
+    {
+        const std::string_view view = aoc::trim(line);
+        if (view.empty() || view.starts_with('#'))
+        {
+            continue;
+        }
+
+        const auto space = view.find_first_of(" \t");
+        if (space == std::string_view::npos)
+        {
+            throw std::runtime_error("Invalid manifest line: " + line);
+        }
+        const std::string_view puzzle = view.substr(0, space);
+        const std::filesystem::path file = options.batch.parent_path() / aoc::trim(view.substr(space + 1));
+
+        if (puzzle.find('.') == std::string_view::npos)
+        {
+            throw std::runtime_error("Manifest jobs must name a day: " + line);
+        }
+
+        bool known = false;
+        for (const auto &solution : solutions)
+        {
+            if (matches(solution, puzzle))
+            {
+                known = true;
+                if (selected(solution))
+                {
+                    add(solution, file);
+                }
+            }
+        }
+        if (!known)
+        {
+            throw std::runtime_error("Unknown puzzle in manifest: " + std::string(puzzle));
+        }
+    }
+    return jobs;
+}
+
+/**
+ * @brief Write one finished part of a batch job.
+ *
+ * Text and CSV print one line per part; JSON prints one object per line
+ * (JSON Lines), so the output can be consumed while the batch is running.
+ *
+ * @param out Output stream
+ * @param s Finished part
+ * @param file Its input file
+ * @param result Its outcome
+ * @param options Runner configuration
+ */
+void print_batch_result(std::ostream &out, const Solution &s, const std::filesystem::path &file,
+                        const BatchResult &result, const Options &options)
+{
+    const std::string status = result.error.empty() ? "ok" : "error";
+    if (options.format == "json")
+    {
+        out << "{\"year\": " << s.year << ", \"day\": " << s.day << ", \"part\": " << s.part << ", \"file\": \""
+            << json_escape(file.string()) << "\", \"status\": \"" << status << "\", ";
+        if (!result.error.empty())
+        {
+            out << "\"error\": \"" << json_escape(result.error) << "\"}\n";
+        }
+        else
+        {
+            out << "\"answer\": \"" << json_escape(result.answer) << "\", \"unit\": \"ns\", \"parse\": "
+                << result.parse_ns << ", \"solve\": " << result.solve_ns << "}\n";
+        }
+    }
+    else if (options.format == "csv")
+    {
+        out << s.year << ',' << s.day << ',' << s.part << ',' << csv_field(file.string()) << ',' << status << ','
+            << csv_field(result.error.empty() ? result.answer : result.error) << ',' << result.parse_ns << ','
+            << result.solve_ns << '\n';
+    }
+    else
+    {
+        out << s.year << " Day " << s.day << " Part " << s.part << " " << file.string() << ": ";
+        if (!result.error.empty())
+        {
+            out << "ERROR " << result.error << '\n';
+        }
+        else
+        {
+            out << result.answer << "  parse " << microseconds(result.parse_ns) << "  solve "
+                << microseconds(result.solve_ns) << '\n';
+        }
+    }
+    out.flush();
+}
+
+/**
+ * @brief Solve every batch job concurrently, streaming results as they finish.
+ *
+ * Each job is a parse task that submits one solve task per part, all
+ * sharing the parsed input, on a work-stealing pool with one worker per
+ * hardware thread unless --threads is given. Every parse and every light
+ * solve runs under a ThreadBudget of one thread, so solvers that
+ * parallelise internally stay on their worker, and jobs without heavy
+ * parts are queued first. Heavy solves go through a lane that shares a
+ * budget of all workers but one among them: each gets an equal slice for
+ * its own pool and only as many run at once as the slices allow. Heavy
+ * work thus never uses more than W - 1 threads on W workers, and light
+ * jobs always have a worker unless there is only one.
+ *
+ * @param jobs Jobs to run
+ * @param out Output stream
+ * @param options Runner configuration
+ * @return Number of failed parts
+ */
+[[nodiscard]] std::size_t run_batch(const std::vector<BatchJob> &jobs, std::ostream &out, const Options &options)
+{
+    aoc::ThreadPool pool(options.threads);
+    std::mutex out_mutex;
+    std::size_t failures = 0;
+
+    struct HeavyLane
+    {
+        std::mutex mutex;                          ///< Guards the members below
+        std::deque<std::function<void()>> waiting; ///< Heavy solves not started yet
+        std::size_t running = 0;                   ///< Heavy solves started and not finished
+        std::size_t limit = 1;                     ///< Most heavy solves running at once
+        unsigned budget = 1;                       ///< Threads each heavy solve may start
+    } lane;
+    std::size_t heavy_solves = 0;
+    for (const auto &job : jobs)
+    {
+        heavy_solves += static_cast<std::size_t>(std::count_if(job.parts.begin(), job.parts.end(),
+                                                               [](const Solution *part)
+                                                               { return is_heavy(*part); }));
+    }
+    const std::size_t heavy_threads = std::max<std::size_t>(1, pool.size() - 1);
+    lane.budget = static_cast<unsigned>(heavy_threads / std::clamp<std::size_t>(heavy_solves, 1, heavy_threads));
+    lane.limit = heavy_threads / lane.budget;
+
+    const auto finish = [&](const Solution &solution, const std::filesystem::path &file, const BatchResult &result)
+    {
+        const std::lock_guard lock(out_mutex);
+        failures += result.error.empty() ? 0 : 1;
+        print_batch_result(out, solution, file, result, options);
+    };
+
+    const auto admit = [&](std::function<void()> solve)
+    {
+        {
+            const std::lock_guard lock(lane.mutex);
+            if (lane.running == lane.limit)
+            {
+                lane.waiting.push_back(std::move(solve));
+                return;
+            }
+            lane.running++;
+        }
+        pool.submit(std::move(solve));
+    };
+
+    const auto release = [&]
+    {
+        std::function<void()> next;
+        {
+            const std::lock_guard lock(lane.mutex);
+            if (lane.waiting.empty())
+            {
+                lane.running--;
+                return;
+            }
+            next = std::move(lane.waiting.front());
+            lane.waiting.pop_front();
+        }
+        pool.submit(std::move(next));
+    };
+
+    const auto start = [&](const BatchJob &job)
+    {
+        pool.submit([&, job = &job]
+                    {
+                        const aoc::ThreadBudget budget(1);
+                        BatchResult parsed;
+                        std::shared_ptr<const void> input;
+                        try
+                        {
+                            const auto t0 = Clock::now();
+                            input = job->parts.front()->parse(job->file);
+                            parsed.parse_ns = Nanoseconds(Clock::now() - t0).count();
+                        }
+                        catch (const std::exception &e)
+                        {
+                            parsed.error = e.what();
+                            for (const Solution *part : job->parts)
+                            {
+                                finish(*part, job->file, parsed);
+                            }
+                            return;
+                        }
+
+                        for (const Solution *part : job->parts)
+                        {
+                            const bool heavy = is_heavy(*part);
+                            auto solve = [&, job, part, parsed, input, heavy]
+                            {
+                                const aoc::ThreadBudget budget(heavy ? lane.budget : 1);
+                                BatchResult result = parsed;
+                                try
+                                {
+                                    const auto t1 = Clock::now();
+                                    result.answer = part->solve(input.get());
+                                    result.solve_ns = Nanoseconds(Clock::now() - t1).count();
+                                }
+                                catch (const std::exception &e)
+                                {
+                                    result.error = e.what();
+                                }
+                                finish(*part, job->file, result);
+                                if (heavy)
+                                {
+                                    release();
+                                }
+                            };
+                            if (heavy)
+                            {
+                                admit(std::move(solve));
+                            }
+                            else
+                            {
+                                pool.submit(std::move(solve));
+                            }
+                        } });
+    };
+
+    if (options.format == "csv")
+    {
+        out << "year,day,part,file,status,answer,parse_ns,solve_ns\n";
+    }
+    for (const auto &job : jobs)
+    {
+        if (!has_heavy_part(job))
+        {
+            start(job);
+        }
+    }
+    for (const auto &job : jobs)
+    {
+        if (has_heavy_part(job))
+        {
+            start(job);
+        }
+    }
+
+    pool.wait();
+    return failures;
+}
+
+} // namespace aoc::runner
+
+/**
+ * @brief Main entry point of the runner.
+ *
+ * Usage: runner [--root DIR] [--warmup N] [--iterations N]
+ *               [--format text|json|csv] [--include-slow]
+ *               [--sweep N[,N...]] [--seed N] [--sweep-dir DIR]
+ *               [--batch DIR|MANIFEST] [--threads N] [--parse-cache]
+ *               [YYYY[.D[.P]]...]
+ *
+ * Runs the selected puzzle parts on their input.txt, checks each answer
+ * against README.md and prints per-part parse/solve timings. With --sweep
+ * the parts run on generated inputs of each size instead, and the report
+ * shows how their time scales. With --batch every listed input is solved
+ * once and results are printed as the jobs finish. --parse-cache lets the
+ * puzzles that support it load their parsed input from a binary cache file.
+ *
+ * @return 0 if every answer matches (or every batch job succeeds), 1 on mismatch or error, 2 on bad usage
+ */
+int main(int argc, char **argv)
+{
+    using namespace aoc::runner;
+
+    Options options;
+    try
+    {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+
+    aoc::parse_cache::enable(options.parse_cache);
+
+    try
+    {
+        const auto solutions = all_solutions();
+        if (!options.batch.empty())
+        {
+            return run_batch(batch_jobs(solutions, options), std::cout, options) == 0 ? 0 : 1;
+        }
+
+        const auto expected = read_expected_answers(options.root / "README.md");
+
+        std::vector<Report> reports;
+        std::vector<SweepReport> sweeps;
+        for (const auto &solution : solutions)
+        {
+            const bool selected = options.selectors.empty() ||
+                                  std::any_of(options.selectors.begin(), options.selectors.end(),
+                                              [&](const std::string &s)
+                                              { return matches(solution, s); });
+            const bool explicit_selection = std::any_of(options.selectors.begin(), options.selectors.end(),
+                                                        [&](const std::string &s)
+                                                        { return std::count(s.begin(), s.end(), '.') == 2 && matches(solution, s); });
+
+            if (!selected || (solution.slow && !options.include_slow && !explicit_selection))
+            {
+                continue;
+            }
+
+            if (!options.sweep.empty())
+            {
+                if (const auto *generator = aoc::generate::find_generator(solution.year, solution.day))
+                {
+                    sweeps.push_back(sweep(solution, *generator, options));
+                    reports.insert(reports.end(), sweeps.back().points.begin(), sweeps.back().points.end());
+                }
+                continue;
+            }
+
+            const auto it = expected.find({solution.year, solution.day, solution.part});
+            reports.push_back(benchmark(solution, options, input_path(options.root, solution),
+                                        it == expected.end() ? std::string{} : it->second));
+        }
+
+        if (options.sweep.empty())
+        {
+            print_reports(std::cout, reports, options);
+        }
+        else
+        {
+            print_sweeps(std::cout, sweeps, options);
+        }
+
+        const bool all_ok = std::all_of(reports.begin(), reports.end(), [](const Report &r)
+                                        { return r.status == "ok" || r.status == "unknown"; });
+        return all_ok ? 0 : 1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}